@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/acp.c" "CMakeFiles/acp_static.dir/acp.c.o" "gcc" "CMakeFiles/acp_static.dir/acp.c.o.d"
+  "/root/repo/acp_cobs.c" "CMakeFiles/acp_static.dir/acp_cobs.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_cobs.c.o.d"
+  "/root/repo/acp_constants.c" "CMakeFiles/acp_static.dir/acp_constants.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_constants.c.o.d"
+  "/root/repo/acp_cpu.c" "CMakeFiles/acp_static.dir/acp_cpu.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_cpu.c.o.d"
+  "/root/repo/acp_crc16.c" "CMakeFiles/acp_static.dir/acp_crc16.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_crc16.c.o.d"
+  "/root/repo/acp_crypto.c" "CMakeFiles/acp_static.dir/acp_crypto.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_crypto.c.o.d"
+  "/root/repo/acp_framer.c" "CMakeFiles/acp_static.dir/acp_framer.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_framer.c.o.d"
+  "/root/repo/acp_nvs.c" "CMakeFiles/acp_static.dir/acp_nvs.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_nvs.c.o.d"
+  "/root/repo/acp_platform_posix.c" "CMakeFiles/acp_static.dir/acp_platform_posix.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_platform_posix.c.o.d"
+  "/root/repo/acp_ring.c" "CMakeFiles/acp_static.dir/acp_ring.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_ring.c.o.d"
+  "/root/repo/acp_scan.c" "CMakeFiles/acp_static.dir/acp_scan.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_scan.c.o.d"
+  "/root/repo/acp_session.c" "CMakeFiles/acp_static.dir/acp_session.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_session.c.o.d"
+  "/root/repo/acp_session_table.c" "CMakeFiles/acp_static.dir/acp_session_table.c.o" "gcc" "CMakeFiles/acp_static.dir/acp_session_table.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
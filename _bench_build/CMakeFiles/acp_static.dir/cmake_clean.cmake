@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/acp_static.dir/acp.c.o"
+  "CMakeFiles/acp_static.dir/acp.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_cobs.c.o"
+  "CMakeFiles/acp_static.dir/acp_cobs.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_constants.c.o"
+  "CMakeFiles/acp_static.dir/acp_constants.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_cpu.c.o"
+  "CMakeFiles/acp_static.dir/acp_cpu.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_crc16.c.o"
+  "CMakeFiles/acp_static.dir/acp_crc16.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_crypto.c.o"
+  "CMakeFiles/acp_static.dir/acp_crypto.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_framer.c.o"
+  "CMakeFiles/acp_static.dir/acp_framer.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_nvs.c.o"
+  "CMakeFiles/acp_static.dir/acp_nvs.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_platform_posix.c.o"
+  "CMakeFiles/acp_static.dir/acp_platform_posix.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_ring.c.o"
+  "CMakeFiles/acp_static.dir/acp_ring.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_scan.c.o"
+  "CMakeFiles/acp_static.dir/acp_scan.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_session.c.o"
+  "CMakeFiles/acp_static.dir/acp_session.c.o.d"
+  "CMakeFiles/acp_static.dir/acp_session_table.c.o"
+  "CMakeFiles/acp_static.dir/acp_session_table.c.o.d"
+  "libacp.a"
+  "libacp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/acp_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
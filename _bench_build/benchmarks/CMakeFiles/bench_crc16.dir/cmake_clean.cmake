@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_crc16.dir/bench_crc16.c.o"
+  "CMakeFiles/bench_crc16.dir/bench_crc16.c.o.d"
+  "bench_crc16"
+  "bench_crc16.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench_crc16.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_decode.dir/bench_decode.c.o"
+  "CMakeFiles/bench_decode.dir/bench_decode.c.o.d"
+  "bench_decode"
+  "bench_decode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
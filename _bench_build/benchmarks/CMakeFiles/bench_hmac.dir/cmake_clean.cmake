@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_hmac.dir/bench_hmac.c.o"
+  "CMakeFiles/bench_hmac.dir/bench_hmac.c.o.d"
+  "bench_hmac"
+  "bench_hmac.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench_hmac.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_session_table.dir/bench_session_table.c.o"
+  "CMakeFiles/bench_session_table.dir/bench_session_table.c.o.d"
+  "bench_session_table"
+  "bench_session_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench_session_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -37,6 +37,7 @@
 #include "acp_errors.h"
 #include "acp_crc16.h"
 #include "acp_cobs.h"
+#include "acp_scan.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -61,9 +62,6 @@ acp_result_t acp_init(void)
         return ACP_OK; /* Already initialized */
     }
 
-    /* Initialize CRC16 lookup table */
-    acp_crc16_init_table();
-
     /* TODO: Initialize other subsystems as they're implemented */
     /* - Platform shims */
     /* - Crypto subsystem */
@@ -91,6 +89,140 @@ void acp_cleanup(void)
     acp_initialized = 0;
 }
 
+/**
+ * @brief Check the frame type and authentication policy for transmission
+ */
+static acp_result_t acp_check_tx_frame(uint8_t type, uint8_t flags, const acp_session_t *session)
+{
+    if (!acp_is_valid_frame_type(type))
+    {
+        return ACP_ERR_INVALID_TYPE;
+    }
+
+    /* Check authentication requirements */
+    if (acp_frame_requires_auth(type) && !(flags & ACP_FLAG_AUTHENTICATED))
+    {
+        return ACP_ERR_AUTH_REQUIRED;
+    }
+    if ((flags & ACP_FLAG_AUTHENTICATED) && session == NULL)
+    {
+        return ACP_ERR_SESSION_NOT_INIT;
+    }
+
+    return ACP_OK;
+}
+
+/**
+ * @brief Compute the truncated HMAC tag of an encoded frame
+ *
+ * Covers the encoded bytes between the delimiters, given in one piece or
+ * several. With extended sequence numbers the high 32 bits of @p sequence,
+ * which are not sent, follow in big-endian order.
+ */
+static void acp_frame_tag(const acp_session_t *session,
+                          const acp_iovec_t *encoded, size_t encoded_count,
+                          uint64_t sequence, uint8_t tag[ACP_HMAC_TAG_LEN])
+{
+    if (encoded_count == 1 && !session->extended_seq)
+    {
+        acp_hmac_sha256_midstate(&session->hmac, (const uint8_t *)encoded[0].base, encoded[0].len, tag);
+        return;
+    }
+
+    acp_hmac_ctx_t ctx;
+    acp_hmac_init_midstate(&ctx, &session->hmac);
+    for (size_t i = 0; i < encoded_count; i++)
+    {
+        acp_hmac_update(&ctx, (const uint8_t *)encoded[i].base, encoded[i].len);
+    }
+    if (session->extended_seq)
+    {
+        uint32_t high = (uint32_t)(sequence >> 32);
+        uint8_t high_be[4] = {(uint8_t)(high >> 24), (uint8_t)(high >> 16), (uint8_t)(high >> 8), (uint8_t)high};
+        acp_hmac_update(&ctx, high_be, sizeof(high_be));
+    }
+    acp_hmac_final(&ctx, tag, 1);
+}
+
+/**
+ * @brief Encode one frame from payload segments and append its HMAC tag
+ *
+ * The caller supplies the sequence number and advances the session's
+ * counter. On ACP_ERR_BUFFER_TOO_SMALL caused by the tag, @p frame_len
+ * returns the size that would have been needed.
+ */
+static acp_result_t acp_encode_segments(uint8_t type, uint8_t flags,
+                                        const acp_iovec_t *payload, size_t payload_count,
+                                        uint64_t sequence, const acp_session_t *session,
+                                        uint8_t *output, size_t output_size, size_t *frame_len)
+{
+    *frame_len = 0;
+
+    /* Without extended sequence numbers the counter must not wrap: rotate first */
+    if ((flags & ACP_FLAG_AUTHENTICATED) && !session->extended_seq && sequence > UINT32_MAX)
+    {
+        return ACP_ERR_SESSION_EXPIRED;
+    }
+
+    /* Describe the frame; the payload is referenced, not copied */
+    acp_frame_view_t frame = {0};
+    frame.version = ACP_PROTOCOL_VERSION;
+    frame.type = type;
+    frame.flags = flags;
+    if (flags & ACP_FLAG_AUTHENTICATED)
+    {
+        frame.sequence = (uint32_t)sequence; /* Low 32 bits on the wire */
+    }
+
+    /* Encode the frame straight into the output using the framer */
+    size_t frame_size = 0;
+    int result = acp_frame_encode_iov(&frame, payload, payload_count, output, output_size, &frame_size);
+    if (result != ACP_OK)
+    {
+        return result;
+    }
+
+    /* For authenticated frames, append HMAC tag */
+    if (flags & ACP_FLAG_AUTHENTICATED)
+    {
+        /* Check if we have space for HMAC tag */
+        if (output_size < frame_size + ACP_HMAC_TAG_LEN)
+        {
+            *frame_len = frame_size + ACP_HMAC_TAG_LEN;
+            return ACP_ERR_BUFFER_TOO_SMALL;
+        }
+
+        /* Truncated HMAC over the encoded frame (excluding delimiters), written after it */
+        acp_iovec_t encoded = {output + 1, frame_size - 2};
+        acp_frame_tag(session, &encoded, 1, sequence, output + frame_size);
+        frame_size += ACP_HMAC_TAG_LEN;
+    }
+
+    *frame_len = frame_size;
+    return ACP_OK;
+}
+
+/**
+ * @brief Pick the sequence number for the next frame sent on a session
+ *
+ * In concurrent mode the number is reserved up front; otherwise the
+ * caller advances the counter once the frame is encoded.
+ */
+static acp_result_t acp_take_sequence(uint8_t flags, acp_session_t *session, uint64_t *sequence)
+{
+    *sequence = 0;
+    if (!(flags & ACP_FLAG_AUTHENTICATED))
+    {
+        return ACP_OK;
+    }
+    if (session->concurrent_tx)
+    {
+        return acp_session_reserve_sequences(session, 1, sequence);
+    }
+    *sequence = session->next_sequence;
+    return ACP_OK;
+}
+
 /**
  * @brief Encode an ACP frame
  */
@@ -108,193 +240,635 @@ acp_result_t acp_encode_frame(
     {
         return ACP_ERR_INVALID_PARAM;
     }
+    if (payload_len > ACP_MAX_PAYLOAD_SIZE)
+    {
+        return ACP_ERR_PAYLOAD_TOO_LARGE;
+    }
+
+    acp_iovec_t segment = {payload, payload_len};
+    return acp_encode_frame_iov(type, flags, &segment, 1, session, output, output_len);
+}
+
+/**
+ * @brief Encode an ACP frame from scattered payload segments
+ */
+acp_result_t acp_encode_frame_iov(
+    uint8_t type,
+    uint8_t flags,
+    const acp_iovec_t *payload,
+    size_t payload_count,
+    acp_session_t *session,
+    uint8_t *output,
+    size_t *output_len)
+{
+    /* Parameter validation; segment lengths are checked by the framer */
+    if (payload == NULL && payload_count > 0)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
     if (output == NULL || output_len == NULL)
     {
         return ACP_ERR_INVALID_PARAM;
     }
-    if (payload_len > ACP_MAX_PAYLOAD_SIZE)
+
+    acp_result_t result = acp_check_tx_frame(type, flags, session);
+    if (result != ACP_OK)
     {
-        return ACP_ERR_PAYLOAD_TOO_LARGE;
+        return result;
     }
-    if (!acp_is_valid_frame_type(type))
+
+    uint64_t sequence;
+    result = acp_take_sequence(flags, session, &sequence);
+    if (result != ACP_OK)
     {
-        return ACP_ERR_INVALID_TYPE;
+        return result;
     }
 
-    /* Check authentication requirements */
-    if (acp_frame_requires_auth(type) && !(flags & ACP_FLAG_AUTHENTICATED))
+    size_t frame_size;
+    result = acp_encode_segments(type, flags, payload, payload_count, sequence, session,
+                                 output, *output_len, &frame_size);
+    if (result != ACP_OK)
     {
-        return ACP_ERR_AUTH_REQUIRED;
+        if (result == ACP_ERR_BUFFER_TOO_SMALL && frame_size > 0)
+        {
+            *output_len = frame_size;
+        }
+        return result;
     }
-    if ((flags & ACP_FLAG_AUTHENTICATED) && session == NULL)
+
+    /* Update session sequence number */
+    if ((flags & ACP_FLAG_AUTHENTICATED) && !session->concurrent_tx)
     {
-        return ACP_ERR_SESSION_NOT_INIT;
+        session->next_sequence++;
     }
 
-    /* Construct frame structure */
-    acp_frame_t frame = {0};
-    frame.version = ACP_PROTOCOL_VERSION;
-    frame.type = type;
-    frame.flags = flags;
-    frame.length = (uint16_t)payload_len;
+    *output_len = frame_size;
+    return ACP_OK;
+}
 
-    /* Set sequence number for authenticated frames */
-    if (flags & ACP_FLAG_AUTHENTICATED)
+/**
+ * @brief Encode an authenticated frame with a caller-supplied sequence number
+ */
+acp_result_t acp_encode_frame_seq(
+    uint8_t type,
+    const acp_iovec_t *payload,
+    size_t payload_count,
+    const acp_session_t *session,
+    uint64_t sequence,
+    uint8_t *output,
+    size_t *output_len)
+{
+    if (payload == NULL && payload_count > 0)
     {
-        frame.sequence = session->next_sequence;
+        return ACP_ERR_INVALID_PARAM;
     }
-
-    /* Copy payload */
-    if (payload_len > 0)
+    if (output == NULL || output_len == NULL)
     {
-        memcpy(frame.payload, payload, payload_len);
+        return ACP_ERR_INVALID_PARAM;
     }
 
-    /* Encode the frame using the framer */
-    size_t frame_size;
-    int result = acp_frame_encode(&frame, output, *output_len, &frame_size);
+    acp_result_t result = acp_check_tx_frame(type, ACP_FLAG_AUTHENTICATED, session);
     if (result != ACP_OK)
     {
         return result;
     }
 
-    /* For authenticated frames, append HMAC tag */
-    if (flags & ACP_FLAG_AUTHENTICATED)
+    size_t frame_size;
+    result = acp_encode_segments(type, ACP_FLAG_AUTHENTICATED, payload, payload_count, sequence, session,
+                                 output, *output_len, &frame_size);
+    if (result == ACP_OK || (result == ACP_ERR_BUFFER_TOO_SMALL && frame_size > 0))
     {
-        /* Check if we have space for HMAC tag */
-        if (*output_len < frame_size + ACP_HMAC_TAG_LEN)
+        *output_len = frame_size;
+    }
+    return result;
+}
+
+/**
+ * @brief Encode several frames back to back into one buffer
+ */
+acp_result_t acp_encode_batch(
+    const acp_encode_desc_t *descs,
+    size_t count,
+    acp_session_t *session,
+    uint8_t *output,
+    size_t output_size,
+    size_t *offsets,
+    size_t *encoded,
+    size_t *output_len)
+{
+    if ((descs == NULL && count > 0) || output == NULL || encoded == NULL || output_len == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    /* Sequence numbers for the batch are one consecutive block */
+    uint64_t next_sequence = session ? session->next_sequence : 0;
+    bool reserved = session && session->concurrent_tx;
+    if (reserved)
+    {
+        uint32_t authenticated = 0;
+        for (size_t d = 0; d < count; d++)
         {
-            *output_len = frame_size + ACP_HMAC_TAG_LEN;
-            return ACP_ERR_BUFFER_TOO_SMALL;
+            if (descs[d].flags & ACP_FLAG_AUTHENTICATED)
+            {
+                authenticated++;
+            }
         }
+        if (authenticated > 0)
+        {
+            acp_result_t reserve = acp_session_reserve_sequences(session, authenticated, &next_sequence);
+            if (reserve != ACP_OK)
+            {
+                *encoded = 0;
+                *output_len = 0;
+                return reserve;
+            }
+        }
+    }
+    acp_result_t result = ACP_OK;
+    size_t pos = 0;
+    size_t i;
 
-        /* Calculate HMAC over the encoded frame (excluding delimiters) */
-        uint8_t hmac_tag[32]; /* Full SHA-256 output */
-        acp_hmac_sha256(session->key, ACP_KEY_SIZE,
-                        output + 1, frame_size - 2, /* Skip delimiters */
-                        hmac_tag);
+    for (i = 0; i < count; i++)
+    {
+        const acp_encode_desc_t *desc = &descs[i];
 
-        /* Append truncated HMAC tag after the complete frame */
-        memcpy(output + frame_size, hmac_tag, ACP_HMAC_TAG_LEN);
-        frame_size += ACP_HMAC_TAG_LEN;
+        result = acp_check_tx_frame(desc->type, desc->flags, session);
+        if (result != ACP_OK)
+        {
+            break;
+        }
 
-        /* Update session sequence number */
-        session->next_sequence++;
+        size_t frame_size;
+        result = acp_encode_segments(desc->type, desc->flags, desc->payload, desc->payload_count,
+                                     next_sequence, session,
+                                     output + pos, output_size - pos, &frame_size);
+        if (result != ACP_OK)
+        {
+            break;
+        }
+
+        if (offsets)
+        {
+            offsets[i] = pos;
+        }
+        pos += frame_size;
+
+        if (desc->flags & ACP_FLAG_AUTHENTICATED)
+        {
+            next_sequence++;
+        }
     }
 
-    *output_len = frame_size;
+    /*
+     * Consume only the sequence numbers of frames actually encoded; a
+     * reserved block is already taken and its unused tail is skipped.
+     */
+    if (session && !reserved)
+    {
+        session->next_sequence = next_sequence;
+    }
+
+    *encoded = i;
+    *output_len = pos;
+    return result;
+}
+
+/**
+ * @brief Initialize a transmit buffer
+ */
+acp_result_t acp_tx_init(acp_tx_buffer_t *tx, uint8_t *buffer, size_t size, acp_session_t *session)
+{
+    if (tx == NULL || buffer == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    tx->buffer = buffer;
+    tx->size = size;
+    tx->length = 0;
+    tx->reserved = 0;
+    tx->session = session;
     return ACP_OK;
 }
 
 /**
- * @brief Decode an ACP frame from stream
+ * @brief Reserve space for the next frame's payload
  */
-acp_result_t acp_decode_frame(
-    const uint8_t *input,
-    size_t input_len,
-    acp_frame_t *frame,
-    size_t *consumed,
-    acp_session_t *session)
+acp_result_t acp_tx_reserve(acp_tx_buffer_t *tx, size_t max_payload, acp_tx_span_t *span)
 {
-    /* Parameter validation */
-    if (input == NULL || frame == NULL || consumed == NULL)
+    if (tx == NULL || span == NULL || tx->reserved != 0)
     {
         return ACP_ERR_INVALID_PARAM;
     }
-    if (input_len == 0)
+    if (max_payload > ACP_MAX_PAYLOAD_SIZE)
     {
-        return ACP_ERR_NEED_MORE_DATA;
+        return ACP_ERR_PAYLOAD_TOO_LARGE;
     }
 
-    *consumed = 0;
-    memset(frame, 0, sizeof(*frame));
+    size_t needed = ACP_TX_RESERVE_SIZE(max_payload);
+    if (tx->size - tx->length < needed)
+    {
+        return ACP_ERR_BUFFER_TOO_SMALL;
+    }
 
-    /* For authenticated frames, we need to handle HMAC verification */
-    /* First, try to find frame boundaries to determine if frame is authenticated */
+    /* The frame will start at the current end; the payload sits past the headroom */
+    tx->reserved = needed;
+    span->tx = tx;
+    span->payload = tx->buffer + tx->length + ACP_TX_HEADROOM(max_payload);
+    span->max_payload = max_payload;
+    return ACP_OK;
+}
 
-    /* Find frame start delimiter */
-    if (input[0] != ACP_COBS_DELIMITER)
+/**
+ * @brief Turn a filled reservation into a frame
+ */
+acp_result_t acp_tx_commit(acp_tx_span_t *span, uint8_t type, uint8_t flags, size_t len)
+{
+    if (span == NULL || span->tx == NULL || span->payload == NULL || span->tx->reserved == 0)
     {
-        return ACP_ERR_MALFORMED_FRAME;
+        return ACP_ERR_INVALID_PARAM;
     }
 
-    /* Find frame end delimiter */
-    size_t frame_end = 0;
-    for (size_t i = 1; i < input_len; i++)
+    acp_tx_buffer_t *tx = span->tx;
+    acp_result_t result = (len > span->max_payload) ? ACP_ERR_PAYLOAD_TOO_LARGE
+                                                    : acp_check_tx_frame(type, flags, tx->session);
+    if (result == ACP_OK)
     {
-        if (input[i] == ACP_COBS_DELIMITER)
+        /*
+         * The payload is one segment inside the output: the framer stuffs it
+         * forward over the headroom, never overtaking the bytes it reads.
+         */
+        acp_iovec_t segment = {span->payload, len};
+        uint64_t sequence;
+        size_t frame_size;
+        result = acp_take_sequence(flags, tx->session, &sequence);
+        if (result == ACP_OK)
         {
-            frame_end = i;
-            break;
+            result = acp_encode_segments(type, flags, &segment, 1, sequence, tx->session,
+                                         tx->buffer + tx->length, tx->reserved, &frame_size);
+        }
+        if (result == ACP_OK)
+        {
+            tx->length += frame_size;
+            if ((flags & ACP_FLAG_AUTHENTICATED) && !tx->session->concurrent_tx)
+            {
+                tx->session->next_sequence++;
+            }
         }
     }
 
-    if (frame_end == 0)
+    acp_tx_abort(span);
+    return result;
+}
+
+/**
+ * @brief Release a reservation without producing a frame
+ */
+void acp_tx_abort(acp_tx_span_t *span)
+{
+    if (span == NULL || span->tx == NULL)
+    {
+        return;
+    }
+
+    span->tx->reserved = 0;
+    span->payload = NULL;
+    span->max_payload = 0;
+}
+
+/**
+ * @brief Discard committed frames once they have been written out
+ */
+void acp_tx_reset(acp_tx_buffer_t *tx)
+{
+    if (tx == NULL)
+    {
+        return;
+    }
+
+    tx->length = 0;
+    tx->reserved = 0;
+}
+
+/**
+ * @brief Apply authentication and replay policy to a decoded frame
+ *
+ * @param view          Decoded frame; hmac_tag is set on success
+ * @param encoded       Encoded frame bytes between the delimiters, in one
+ *                      piece or two when the frame crosses a buffer seam
+ * @param encoded_count Number of pieces (1 or 2)
+ * @param tag           Received HMAC tag (NULL if unauthenticated)
+ * @param session       Session for authentication (NULL for unauthenticated)
+ */
+static acp_result_t acp_accept_frame(acp_frame_view_t *view,
+                                     const acp_iovec_t *encoded, size_t encoded_count,
+                                     const uint8_t *tag, acp_session_t *session)
+{
+    if (!(view->flags & ACP_FLAG_AUTHENTICATED))
+    {
+        /* Enforce authentication policy for command frames */
+        if (acp_frame_requires_auth(view->type))
+        {
+            return ACP_ERR_AUTH_REQUIRED;
+        }
+        return ACP_OK;
+    }
+
+    if (session == NULL || !session->initialized)
+    {
+        return ACP_ERR_SESSION_NOT_INIT;
+    }
+
+    /* Verify HMAC over the encoded frame and the inferred high sequence bits */
+    uint64_t sequence = acp_session_infer_sequence(session, view->sequence);
+    uint8_t expected_hmac[ACP_HMAC_TAG_LEN];
+    acp_frame_tag(session, encoded, encoded_count, sequence, expected_hmac);
+
+    /* Compare with received HMAC tag (constant-time) */
+    if (acp_crypto_memcmp_ct(expected_hmac, tag, ACP_HMAC_TAG_LEN) != 0)
+    {
+        return ACP_ERR_AUTH_FAILED;
+    }
+
+    /* Verify sequence number for replay protection and record it */
+    acp_result_t result = acp_session_accept_sequence(session, sequence);
+    if (result != ACP_OK)
+    {
+        return result;
+    }
+
+    view->hmac_tag = tag;
+    return ACP_OK;
+}
+
+/**
+ * @brief Decode an ACP frame from stream without copying the payload
+ */
+acp_result_t acp_decode_frame_view(
+    const uint8_t *input,
+    size_t input_len,
+    uint8_t *decode_buf,
+    size_t decode_buf_size,
+    acp_frame_view_t *view,
+    size_t *consumed,
+    acp_session_t *session)
+{
+    if (input == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    return acp_decode_frame_split(input, input_len, NULL, 0, decode_buf, decode_buf_size,
+                                  view, consumed, session);
+}
+
+/**
+ * @brief Describe stream bytes [offset, offset + len) of a split input as pieces
+ *
+ * @return Number of pieces written to @p pieces (1 or 2)
+ */
+static size_t acp_split_range(const uint8_t *head, size_t head_len, const uint8_t *tail,
+                              size_t offset, size_t len, acp_iovec_t pieces[2])
+{
+    if (offset >= head_len)
+    {
+        pieces[0].base = tail + (offset - head_len);
+        pieces[0].len = len;
+        return 1;
+    }
+    if (offset + len <= head_len)
+    {
+        pieces[0].base = head + offset;
+        pieces[0].len = len;
+        return 1;
+    }
+
+    pieces[0].base = head + offset;
+    pieces[0].len = head_len - offset;
+    pieces[1].base = tail;
+    pieces[1].len = len - pieces[0].len;
+    return 2;
+}
+
+/**
+ * @brief Decode an ACP frame from input split across two spans
+ */
+acp_result_t acp_decode_frame_split(
+    const uint8_t *head,
+    size_t head_len,
+    const uint8_t *tail,
+    size_t tail_len,
+    uint8_t *decode_buf,
+    size_t decode_buf_size,
+    acp_frame_view_t *view,
+    size_t *consumed,
+    acp_session_t *session)
+{
+    /* Parameter validation */
+    if ((head == NULL && head_len > 0) || (tail == NULL && tail_len > 0) ||
+        decode_buf == NULL || view == NULL || consumed == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+    if (head_len + tail_len == 0)
     {
         return ACP_ERR_NEED_MORE_DATA;
     }
 
-    /* Try to decode the frame without HMAC first to check if it's authenticated */
-    acp_frame_t temp_frame;
+    *consumed = 0;
+    memset(view, 0, sizeof(*view));
+
+    /*
+     * Decode the frame into the caller's buffer to check if it's authenticated.
+     * The framer finds the end delimiter in the same pass as COBS and CRC.
+     */
+    acp_frame_view_t decoded;
     size_t frame_consumed;
-    int result = acp_frame_decode(input, frame_end + 1, &temp_frame, &frame_consumed);
+    int result = acp_frame_decode_view_split(head, head_len, tail, tail_len, decode_buf, decode_buf_size,
+                                             &decoded, &frame_consumed);
     if (result != ACP_OK)
     {
+        /* Noise or a damaged frame: skip to the next delimiter */
+        *consumed = frame_consumed;
         return result;
     }
 
-    /* If frame is authenticated, verify HMAC */
-    if (temp_frame.flags & ACP_FLAG_AUTHENTICATED)
+    /* Authenticated frames carry the raw tag right after the closing delimiter */
+    const uint8_t *received_hmac = NULL;
+    if (decoded.flags & ACP_FLAG_AUTHENTICATED)
     {
         if (session == NULL || !session->initialized)
         {
             return ACP_ERR_SESSION_NOT_INIT;
         }
-
-        /* Check if we have HMAC tag after the frame */
-        size_t total_size = frame_consumed + ACP_HMAC_TAG_LEN;
-        if (input_len < total_size)
+        if (head_len + tail_len < frame_consumed + ACP_HMAC_TAG_LEN)
         {
             return ACP_ERR_NEED_MORE_DATA;
         }
 
-        /* Verify HMAC over the encoded frame (excluding delimiters) */
-        uint8_t expected_hmac[32];
-        acp_hmac_sha256(session->key, ACP_KEY_SIZE,
-                        input + 1, frame_consumed - 2, /* Skip delimiters */
-                        expected_hmac);
-
-        /* Compare with received HMAC tag (constant-time) */
-        const uint8_t *received_hmac = input + frame_consumed;
-        if (acp_crypto_memcmp_ct(expected_hmac, received_hmac, ACP_HMAC_TAG_LEN) != 0)
+        acp_iovec_t tag_pieces[2];
+        if (acp_split_range(head, head_len, tail, frame_consumed, ACP_HMAC_TAG_LEN, tag_pieces) == 1)
         {
-            return ACP_ERR_AUTH_FAILED;
+            received_hmac = (const uint8_t *)tag_pieces[0].base;
         }
-
-        /* Verify sequence number for replay protection */
-        if (temp_frame.sequence <= session->last_accepted_seq)
+        else
         {
-            return ACP_ERR_REPLAY;
+            /* A tag split by the seam is gathered behind the decoded frame */
+            size_t tag_offset = (size_t)(decoded.payload - decode_buf) + decoded.length + 2;
+            if (decode_buf_size - tag_offset < ACP_HMAC_TAG_LEN)
+            {
+                return ACP_ERR_BUFFER_TOO_SMALL;
+            }
+            memcpy(decode_buf + tag_offset, tag_pieces[0].base, tag_pieces[0].len);
+            memcpy(decode_buf + tag_offset + tag_pieces[0].len, tag_pieces[1].base, tag_pieces[1].len);
+            received_hmac = decode_buf + tag_offset;
         }
-
-        /* Update session state */
-        session->last_accepted_seq = temp_frame.sequence;
-        *consumed = total_size;
+        *consumed = frame_consumed + ACP_HMAC_TAG_LEN;
     }
     else
     {
-        /* Unauthenticated frame */
         *consumed = frame_consumed;
+    }
 
-        /* Enforce authentication policy for command frames */
-        if (acp_frame_requires_auth(temp_frame.type))
+    /* HMAC covers the encoded frame excluding delimiters */
+    acp_iovec_t encoded[2];
+    size_t encoded_count = acp_split_range(head, head_len, tail, 1, frame_consumed - 2, encoded);
+    result = acp_accept_frame(&decoded, encoded, encoded_count, received_hmac, session);
+    if (result != ACP_OK)
+    {
+        return result;
+    }
+
+    *view = decoded;
+    return ACP_OK;
+}
+
+/**
+ * @brief Decode every complete frame in a receive buffer
+ */
+acp_result_t acp_decode_batch(
+    const uint8_t *input,
+    size_t input_len,
+    uint8_t *decode_buf,
+    size_t decode_buf_size,
+    acp_decode_result_t *results,
+    size_t max_results,
+    size_t *count,
+    size_t *consumed,
+    acp_session_t *session)
+{
+    if ((input == NULL && input_len > 0) || decode_buf == NULL || results == NULL ||
+        count == NULL || consumed == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    size_t pos = 0;
+    size_t n = 0;
+    size_t arena_used = 0;
+
+    while (pos < input_len && n < max_results && decode_buf_size - arena_used >= ACP_DECODE_BUFFER_SIZE)
+    {
+        /* Skip bytes outside any frame up to the next delimiter */
+        if (input[pos] != ACP_COBS_DELIMITER)
         {
-            return ACP_ERR_AUTH_REQUIRED;
+            pos += acp_scan_zero(input + pos, input_len - pos);
+            continue;
+        }
+
+        /* Frame extent up to the closing delimiter; stop if it has not arrived */
+        size_t end = pos + 1 + acp_scan_zero(input + pos + 1, input_len - pos - 1);
+        if (end == input_len)
+        {
+            break;
+        }
+        if (end == pos + 1)
+        {
+            pos++; /* Back-to-back delimiters: idle fill */
+            continue;
+        }
+
+        acp_decode_result_t *r = &results[n];
+        size_t frame_consumed = 0;
+        acp_result_t result = acp_decode_frame_view(input + pos, input_len - pos,
+                                                    decode_buf + arena_used, decode_buf_size - arena_used,
+                                                    &r->view, &frame_consumed, session);
+        if (result == ACP_ERR_NEED_MORE_DATA)
+        {
+            break; /* HMAC tag not yet received */
+        }
+
+        r->result = result;
+        r->offset = pos;
+        if (result == ACP_OK)
+        {
+            /* Decoded header, payload and CRC stay in the arena */
+            arena_used = (size_t)(r->view.payload - decode_buf) + r->view.length + 2;
+        }
+        else if (frame_consumed == 0)
+        {
+            /*
+             * Malformed frame: skip it but leave its closing delimiter, which
+             * may be the opening delimiter of the next frame if this one was
+             * not really a frame (e.g. a zero byte inside a tag).
+             */
+            frame_consumed = end - pos;
         }
+        r->length = frame_consumed;
+        pos += frame_consumed;
+        n++;
+    }
+
+    /* Nothing in trailing bytes without a delimiter can start a frame */
+    *count = n;
+    *consumed = pos;
+    return ACP_OK;
+}
+
+/**
+ * @brief Decode an ACP frame from stream
+ */
+acp_result_t acp_decode_frame(
+    const uint8_t *input,
+    size_t input_len,
+    acp_frame_t *frame,
+    size_t *consumed,
+    acp_session_t *session)
+{
+    /* Parameter validation */
+    if (input == NULL || frame == NULL || consumed == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    memset(frame, 0, sizeof(*frame));
+
+    /* Decode via the view path, then copy the payload out exactly once */
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+    acp_frame_view_t view;
+    acp_result_t result = acp_decode_frame_view(input, input_len, decode_buf, sizeof(decode_buf),
+                                                &view, consumed, session);
+    if (result != ACP_OK)
+    {
+        return result;
+    }
+
+    frame->version = view.version;
+    frame->type = view.type;
+    frame->flags = view.flags;
+    frame->length = view.length;
+    frame->sequence = view.sequence;
+    frame->crc16 = view.crc16;
+    if (view.length > 0)
+    {
+        memcpy(frame->payload, view.payload, view.length);
+    }
+    if (view.hmac_tag != NULL)
+    {
+        memcpy(frame->hmac_tag, view.hmac_tag, ACP_HMAC_TAG_LEN);
     }
 
-    /* Copy the decoded frame */
-    *frame = temp_frame;
     return ACP_OK;
 }
 
@@ -308,6 +882,356 @@ acp_result_t acp_decode_frame(
 /*                            Utility Functions                              */
 /* ========================================================================== */
 
+/* ========================================================================== */
+/*                          Incremental Decoding                              */
+/* ========================================================================== */
+
+/**
+ * @brief Clear per-frame state after an opening delimiter
+ */
+static void acp_decoder_start_frame(acp_decoder_t *decoder)
+{
+    decoder->frame_len = 0;
+    decoder->wire_len = 0;
+    decoder->crc_len = 0;
+    decoder->crc = acp_crc16_init();
+    decoder->block_remaining = 0;
+    decoder->zero_pending = false;
+    decoder->tag_len = 0;
+    decoder->state = ACP_DECODER_FRAME;
+}
+
+/**
+ * @brief Append decoded bytes and keep the CRC two bytes behind
+ *
+ * The last two decoded bytes are the frame's CRC field and must not be
+ * folded into the checksum, so only bytes that are no longer among the
+ * trailing two are folded in.
+ */
+static acp_result_t acp_decoder_emit(acp_decoder_t *decoder, const uint8_t *data, size_t len)
+{
+    if (len > decoder->frame_buf_size - decoder->frame_len)
+    {
+        return ACP_ERR_BUFFER_TOO_SMALL;
+    }
+    memcpy(decoder->frame_buf + decoder->frame_len, data, len);
+    decoder->frame_len += len;
+
+    if (decoder->frame_len > decoder->crc_len + 2)
+    {
+        size_t fold = decoder->frame_len - 2 - decoder->crc_len;
+        decoder->crc = acp_crc16_update(decoder->crc, decoder->frame_buf + decoder->crc_len, fold);
+        decoder->crc_len += fold;
+    }
+    return ACP_OK;
+}
+
+/**
+ * @brief Keep a copy of the encoded bytes for HMAC verification
+ */
+static acp_result_t acp_decoder_record(acp_decoder_t *decoder, const uint8_t *data, size_t len)
+{
+    if (len > decoder->wire_buf_size - decoder->wire_len)
+    {
+        return ACP_ERR_BUFFER_TOO_SMALL;
+    }
+    memcpy(decoder->wire_buf + decoder->wire_len, data, len);
+    decoder->wire_len += len;
+    return ACP_OK;
+}
+
+/**
+ * @brief Count a discarded frame: @p raw_len stream bytes from its opening delimiter
+ */
+static void acp_decoder_discard(acp_decoder_t *decoder, size_t raw_len)
+{
+    decoder->bytes_skipped += raw_len;
+    decoder->frames_rejected++;
+}
+
+/**
+ * @brief Validate a completed frame and apply the session policy
+ */
+static acp_result_t acp_decoder_complete(acp_decoder_t *decoder, acp_frame_view_t *view,
+                                         acp_session_t *session)
+{
+    size_t frame_len = decoder->frame_len;
+    size_t wire_len = decoder->wire_len;
+    uint16_t crc = acp_crc16_finalize(decoder->crc);
+
+    /* Opening delimiter and encoded bytes, plus closing delimiter and tag if collected */
+    size_t raw_len = 1 + wire_len;
+    if (decoder->state == ACP_DECODER_TAG)
+    {
+        raw_len += 1 + decoder->tag_len;
+    }
+
+    /*
+     * The next frame may share this frame's closing delimiter. Only the
+     * counters are cleared, so the view stays valid until the next call.
+     */
+    acp_decoder_start_frame(decoder);
+
+    int result = acp_frame_parse_decoded(decoder->frame_buf, frame_len, crc, view);
+    if (result == ACP_OK)
+    {
+        const uint8_t *tag = (view->flags & ACP_FLAG_AUTHENTICATED) ? decoder->tag : NULL;
+        acp_iovec_t encoded = {decoder->wire_buf, wire_len};
+        result = acp_accept_frame(view, &encoded, 1, tag, session);
+    }
+    if (result != ACP_OK)
+    {
+        acp_decoder_discard(decoder, raw_len);
+    }
+    return (acp_result_t)result;
+}
+
+/**
+ * @brief Initialize an incremental decoder
+ */
+acp_result_t acp_decoder_init(acp_decoder_t *decoder, uint8_t *buffer, size_t buffer_size)
+{
+    if (decoder == NULL || buffer == NULL || buffer_size < 2)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    /* Lower half holds the decoded frame, upper half its encoded image */
+    decoder->frame_buf = buffer;
+    decoder->frame_buf_size = buffer_size / 2;
+    decoder->wire_buf = buffer + decoder->frame_buf_size;
+    decoder->wire_buf_size = buffer_size - decoder->frame_buf_size;
+    decoder->bytes_skipped = 0;
+    decoder->frames_rejected = 0;
+
+    acp_decoder_reset(decoder);
+    return ACP_OK;
+}
+
+/**
+ * @brief Discard any partial frame and hunt for the next delimiter
+ */
+void acp_decoder_reset(acp_decoder_t *decoder)
+{
+    if (decoder == NULL)
+    {
+        return;
+    }
+
+    acp_decoder_start_frame(decoder);
+    decoder->state = ACP_DECODER_HUNT;
+}
+
+/**
+ * @brief Feed stream bytes to the decoder until a frame completes
+ */
+acp_result_t acp_decoder_decode(
+    acp_decoder_t *decoder,
+    const uint8_t *input,
+    size_t input_len,
+    size_t *consumed,
+    acp_frame_view_t *view,
+    acp_session_t *session)
+{
+    if (decoder == NULL || (input == NULL && input_len > 0) || consumed == NULL || view == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    *consumed = 0;
+    size_t pos = 0;
+
+    while (pos < input_len)
+    {
+        if (decoder->state == ACP_DECODER_HUNT)
+        {
+            size_t noise = acp_scan_zero(input + pos, input_len - pos);
+            decoder->bytes_skipped += noise;
+            pos += noise;
+            if (pos == input_len)
+            {
+                break;
+            }
+            pos++;
+            acp_decoder_start_frame(decoder);
+        }
+        else if (decoder->state == ACP_DECODER_TAG)
+        {
+            size_t take = ACP_HMAC_TAG_LEN - decoder->tag_len;
+            if (take > input_len - pos)
+            {
+                take = input_len - pos;
+            }
+            memcpy(decoder->tag + decoder->tag_len, input + pos, take);
+            decoder->tag_len += take;
+            pos += take;
+
+            if (decoder->tag_len == ACP_HMAC_TAG_LEN)
+            {
+                *consumed = pos;
+                return acp_decoder_complete(decoder, view, session);
+            }
+        }
+        else if (decoder->block_remaining == 0)
+        {
+            /* Expecting a COBS code byte or the closing delimiter */
+            uint8_t code = input[pos++];
+            if (code == ACP_COBS_DELIMITER)
+            {
+                if (decoder->wire_len == 0)
+                {
+                    /* Back-to-back delimiters: idle fill between frames */
+                    continue;
+                }
+
+                /*
+                 * Closing delimiter: a pending block zero is implicit, drop it.
+                 * Only a frame that passes its length and CRC checks has a tag
+                 * to collect; a truncated one is rejected here, as this
+                 * delimiter may be the opening one of the next frame.
+                 */
+                if (decoder->frame_len > 2 && (decoder->frame_buf[2] & ACP_FLAG_AUTHENTICATED) &&
+                    acp_frame_parse_decoded(decoder->frame_buf, decoder->frame_len,
+                                            acp_crc16_finalize(decoder->crc), view) == ACP_OK)
+                {
+                    decoder->state = ACP_DECODER_TAG;
+                    continue;
+                }
+                *consumed = pos;
+                return acp_decoder_complete(decoder, view, session);
+            }
+
+            static const uint8_t zero = 0;
+            size_t recorded = decoder->wire_len;
+            if (acp_decoder_record(decoder, &code, 1) != ACP_OK ||
+                (decoder->zero_pending && acp_decoder_emit(decoder, &zero, 1) != ACP_OK))
+            {
+                /* Oversized frame: drop the rest of it while hunting */
+                acp_decoder_discard(decoder, 1 + recorded + 1);
+                acp_decoder_reset(decoder);
+                *consumed = pos;
+                return ACP_ERR_BUFFER_TOO_SMALL;
+            }
+            decoder->block_remaining = (uint8_t)(code - 1);
+            decoder->zero_pending = (code != (uint8_t)(ACP_COBS_BLOCK_SIZE + 1));
+        }
+        else
+        {
+            /* Copy as much of the current block as this chunk holds */
+            size_t run = decoder->block_remaining;
+            if (run > input_len - pos)
+            {
+                run = input_len - pos;
+            }
+            const uint8_t *src = input + pos;
+            size_t clean = acp_scan_zero(src, run);
+            bool delim = (clean < run);
+            run = clean;
+
+            size_t recorded = decoder->wire_len;
+            if (acp_decoder_record(decoder, src, run) != ACP_OK ||
+                acp_decoder_emit(decoder, src, run) != ACP_OK)
+            {
+                /* Oversized frame: drop it through this run, then hunt */
+                acp_decoder_discard(decoder, 1 + recorded + run);
+                acp_decoder_reset(decoder);
+                *consumed = pos + run;
+                return ACP_ERR_BUFFER_TOO_SMALL;
+            }
+            pos += run;
+            decoder->block_remaining = (uint8_t)(decoder->block_remaining - run);
+
+            if (delim)
+            {
+                /* Delimiter inside a block: the frame was truncated, resume from it */
+                acp_decoder_discard(decoder, 1 + decoder->wire_len);
+                acp_decoder_start_frame(decoder);
+                *consumed = pos + 1;
+                return ACP_ERR_COBS_DECODE;
+            }
+        }
+    }
+
+    *consumed = pos;
+    return ACP_ERR_NEED_MORE_DATA;
+}
+
+/* ========================================================================== */
+/*                              Push Parser                                   */
+/* ========================================================================== */
+
+/**
+ * @brief Initialize a push parser
+ */
+acp_result_t acp_parser_init(
+    acp_parser_t *parser,
+    acp_session_t *session,
+    acp_parser_frame_cb_t on_frame,
+    acp_parser_error_cb_t on_error,
+    void *context)
+{
+    if (parser == NULL || on_frame == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    parser->session = session;
+    parser->on_frame = on_frame;
+    parser->on_error = on_error;
+    parser->context = context;
+    parser->offset = 0;
+    return acp_decoder_init(&parser->decoder, parser->buffer, sizeof(parser->buffer));
+}
+
+/**
+ * @brief Drop any partial frame
+ */
+void acp_parser_reset(acp_parser_t *parser)
+{
+    if (parser == NULL)
+    {
+        return;
+    }
+
+    acp_decoder_reset(&parser->decoder);
+}
+
+/**
+ * @brief Feed a chunk through the decoder and dispatch the results
+ *
+ * The decoder always consumes at least the bytes of a rejected frame, so
+ * each pass makes progress and the chunk is walked exactly once.
+ */
+acp_result_t acp_parser_push(acp_parser_t *parser, const uint8_t *data, size_t len)
+{
+    if (parser == NULL || (data == NULL && len > 0))
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    size_t pos = 0;
+    while (pos < len)
+    {
+        acp_frame_view_t view;
+        size_t consumed = 0;
+        acp_result_t result = acp_decoder_decode(&parser->decoder, data + pos, len - pos,
+                                                 &consumed, &view, parser->session);
+        pos += consumed;
+        parser->offset += consumed;
+
+        if (result == ACP_OK)
+        {
+            parser->on_frame(parser->context, &view);
+        }
+        else if (result != ACP_ERR_NEED_MORE_DATA && parser->on_error != NULL)
+        {
+            parser->on_error(parser->context, result, parser->offset);
+        }
+    }
+
+    return ACP_OK;
+}
+
 /**
  * @brief Validate frame type
  */
@@ -29,7 +29,9 @@
  */
 
 #include "acp_cobs.h"
+#include "acp_crc16.h"
 #include "acp_errors.h"
+#include "acp_scan.h"
 #include <string.h>
 
 /* ========================================================================== */
@@ -50,40 +52,190 @@ int acp_cobs_encode(const uint8_t *input, size_t input_len,
         return ACP_ERR_BUFFER_TOO_SMALL;
     }
 
-    const uint8_t *src = input;
-    uint8_t *dst = output;
-    size_t remaining = input_len;
-    size_t encoded = 0;
+    acp_cobs_encoder_t encoder;
+    int result = acp_cobs_encoder_init(&encoder, output, output_size);
+    if (result != ACP_OK)
+    {
+        return result;
+    }
 
-    while (remaining > 0)
+    acp_cobs_encoder_write(&encoder, input, input_len);
+    return acp_cobs_encoder_finish(&encoder, encoded_len);
+}
+
+/* ========================================================================== */
+/*                           Streaming Encoder                               */
+/* ========================================================================== */
+
+/**
+ * @brief Start a new block at the current output position
+ */
+static int cobs_encoder_open_block(acp_cobs_encoder_t *encoder)
+{
+    if (encoder->pos >= encoder->output_size)
+    {
+        encoder->error_code = ACP_ERR_BUFFER_TOO_SMALL;
+        return ACP_ERR_BUFFER_TOO_SMALL;
+    }
+    encoder->code_pos = encoder->pos++;
+    encoder->code = 1;
+    return ACP_OK;
+}
+
+/**
+ * @brief Stuff a single byte into the stream
+ */
+static int cobs_encoder_put(acp_cobs_encoder_t *encoder, uint8_t byte)
+{
+    if (encoder->code == 0 && cobs_encoder_open_block(encoder) != ACP_OK)
+    {
+        return ACP_ERR_BUFFER_TOO_SMALL;
+    }
+
+    if (byte == 0)
+    {
+        /* Zero terminates the block; the next block follows immediately */
+        encoder->output[encoder->code_pos] = encoder->code;
+        return cobs_encoder_open_block(encoder);
+    }
+
+    if (encoder->pos >= encoder->output_size)
+    {
+        encoder->error_code = ACP_ERR_BUFFER_TOO_SMALL;
+        return ACP_ERR_BUFFER_TOO_SMALL;
+    }
+    encoder->output[encoder->pos++] = byte;
+
+    if (++encoder->code == (uint8_t)(ACP_COBS_BLOCK_SIZE + 1))
+    {
+        /* Full block carries no implicit zero; open the next one lazily */
+        encoder->output[encoder->code_pos] = encoder->code;
+        encoder->code = 0;
+    }
+    return ACP_OK;
+}
+
+int acp_cobs_encoder_init(acp_cobs_encoder_t *encoder,
+                          uint8_t *output, size_t output_size)
+{
+    if (!encoder || !output)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    encoder->output = output;
+    encoder->output_size = output_size;
+    encoder->pos = 0;
+    encoder->code_pos = 0;
+    encoder->code = 0;
+    encoder->error_code = ACP_OK;
+
+    return cobs_encoder_open_block(encoder);
+}
+
+int acp_cobs_encoder_write(acp_cobs_encoder_t *encoder,
+                           const uint8_t *data, size_t len)
+{
+    if (!encoder || (!data && len > 0))
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+    if (encoder->error_code != ACP_OK)
+    {
+        return encoder->error_code;
+    }
+
+    while (len > 0)
     {
-        /* Find next zero byte or end of block */
-        size_t block_len = 0;
-        while (block_len < remaining && block_len < ACP_COBS_BLOCK_SIZE && src[block_len] != 0)
+        if (encoder->code == 0 && cobs_encoder_open_block(encoder) != ACP_OK)
         {
-            block_len++;
+            return encoder->error_code;
         }
 
-        /* Write block length code */
-        *dst++ = (uint8_t)(block_len + 1);
-        encoded++;
+        /* Copy the longest zero-free run that still fits in the open block */
+        size_t room = (size_t)(ACP_COBS_BLOCK_SIZE + 1) - encoder->code;
+        size_t limit = (len < room) ? len : room;
+        size_t run = acp_scan_zero(data, limit);
+        int zero = (run < limit);
 
-        /* Copy non-zero bytes */
-        memcpy(dst, src, block_len);
-        dst += block_len;
-        src += block_len;
-        encoded += block_len;
-        remaining -= block_len;
+        if (run > encoder->output_size - encoder->pos)
+        {
+            encoder->error_code = ACP_ERR_BUFFER_TOO_SMALL;
+            return encoder->error_code;
+        }
+        /* memmove: in-place encoding writes just behind the bytes being read */
+        memmove(encoder->output + encoder->pos, data, run);
+        encoder->pos += run;
+        encoder->code = (uint8_t)(encoder->code + run);
+        data += run;
+        len -= run;
+
+        if (zero)
+        {
+            /* Let the single-byte path close the block on the zero */
+            if (cobs_encoder_put(encoder, 0) != ACP_OK)
+            {
+                return encoder->error_code;
+            }
+            data++;
+            len--;
+        }
+        else if (encoder->code == (uint8_t)(ACP_COBS_BLOCK_SIZE + 1))
+        {
+            encoder->output[encoder->code_pos] = encoder->code;
+            encoder->code = 0;
+        }
+    }
+
+    return ACP_OK;
+}
+
+int acp_cobs_encoder_write_crc16(acp_cobs_encoder_t *encoder,
+                                 const uint8_t *data, size_t len,
+                                 uint16_t *crc)
+{
+    if (!encoder || !crc || (!data && len > 0))
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+    if (encoder->error_code != ACP_OK)
+    {
+        return encoder->error_code;
+    }
 
-        /* Skip zero byte if present */
-        if (remaining > 0 && *src == 0)
+    /* Fold and stuff one block-sized chunk at a time while it is in L1 */
+    while (len > 0)
+    {
+        size_t chunk = (len < ACP_COBS_BLOCK_SIZE) ? len : ACP_COBS_BLOCK_SIZE;
+        *crc = acp_crc16_update(*crc, data, chunk); /* Before stuffing may overwrite it in place */
+        if (acp_cobs_encoder_write(encoder, data, chunk) != ACP_OK)
         {
-            src++;
-            remaining--;
+            return encoder->error_code;
         }
+        data += chunk;
+        len -= chunk;
     }
 
-    *encoded_len = encoded;
+    return ACP_OK;
+}
+
+int acp_cobs_encoder_finish(acp_cobs_encoder_t *encoder, size_t *encoded_len)
+{
+    if (!encoder || !encoded_len)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+    if (encoder->error_code != ACP_OK)
+    {
+        return encoder->error_code;
+    }
+
+    if (encoder->code != 0)
+    {
+        encoder->output[encoder->code_pos] = encoder->code;
+    }
+
+    *encoded_len = encoder->pos;
     return ACP_OK;
 }
 
@@ -155,6 +307,137 @@ int acp_cobs_decode(const uint8_t *input, size_t input_len,
     return ACP_OK;
 }
 
+int acp_cobs_decode_crc16(const uint8_t *input, size_t input_len,
+                          uint8_t *output, size_t output_size,
+                          size_t *decoded_len, size_t *consumed,
+                          uint16_t *crc)
+{
+    if (!input)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    return acp_cobs_decode_crc16_split(input, input_len, NULL, 0, output, output_size,
+                                       decoded_len, consumed, crc);
+}
+
+int acp_cobs_decode_crc16_split(const uint8_t *head, size_t head_len,
+                                const uint8_t *tail, size_t tail_len,
+                                uint8_t *output, size_t output_size,
+                                size_t *decoded_len, size_t *consumed,
+                                uint16_t *crc)
+{
+    if ((!head && head_len > 0) || (!tail && tail_len > 0) || !output || !decoded_len || !consumed || !crc)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    *decoded_len = 0;
+    *consumed = 0;
+
+    /* Current span and the one after it; base is the current span's stream offset */
+    const uint8_t *input = head;
+    size_t input_len = head_len;
+    const uint8_t *next = tail;
+    size_t next_len = tail_len;
+    size_t base = 0;
+
+    uint16_t state = ACP_CRC16_INIT;
+    size_t pos = 0;
+    size_t decoded = 0;
+    size_t folded = 0;
+    int zero_pending = 0;
+
+    /*
+     * The CRC runs two bytes behind the output: the last two decoded bytes
+     * are the frame's CRC field and must not be folded into the checksum.
+     * Each block is copied out and then folded with the slice-by-8 update
+     * while it is still in L1, up to two bytes short of the output.
+     */
+    for (;;)
+    {
+        if (pos >= input_len)
+        {
+            if (next_len == 0)
+            {
+                return ACP_ERR_NEED_MORE_DATA;
+            }
+            base += input_len;
+            input = next;
+            input_len = next_len;
+            next_len = 0;
+            pos = 0;
+        }
+
+        uint8_t code = input[pos++];
+        if (code == ACP_COBS_DELIMITER)
+        {
+            /* Closing delimiter: a pending block zero is implicit, drop it */
+            break;
+        }
+
+        /* Block data may run on into the next span */
+        size_t block_len = (size_t)code - 1;
+        size_t first = (block_len < input_len - pos) ? block_len : input_len - pos;
+        size_t second = (block_len - first < next_len) ? block_len - first : next_len;
+
+        /* A delimiter inside the block means the frame was truncated */
+        size_t clean = acp_scan_zero(input + pos, first);
+        if (clean < first)
+        {
+            *consumed = base + pos + clean + 1;
+            return ACP_ERR_COBS_DECODE;
+        }
+        clean = second ? acp_scan_zero(next, second) : 0;
+        if (clean < second)
+        {
+            *consumed = base + input_len + clean + 1;
+            return ACP_ERR_COBS_DECODE;
+        }
+        if (first + second < block_len)
+        {
+            /* Block runs past the available input */
+            return ACP_ERR_NEED_MORE_DATA;
+        }
+
+        if (zero_pending + block_len > output_size - decoded)
+        {
+            return ACP_ERR_BUFFER_TOO_SMALL;
+        }
+        if (zero_pending)
+        {
+            output[decoded++] = 0;
+        }
+        memcpy(output + decoded, input + pos, first);
+        decoded += first;
+        pos += first;
+        if (second > 0)
+        {
+            /* Block straddles the seam: the rest comes from the start of the next span */
+            memcpy(output + decoded, next, second);
+            decoded += second;
+            base += input_len;
+            input = next;
+            input_len = next_len;
+            next_len = 0;
+            pos = second;
+        }
+
+        if (decoded > folded + 2)
+        {
+            state = acp_crc16_update(state, output + folded, decoded - 2 - folded);
+            folded = decoded - 2;
+        }
+
+        zero_pending = (code != (uint8_t)(ACP_COBS_BLOCK_SIZE + 1));
+    }
+
+    *decoded_len = decoded;
+    *consumed = base + pos;
+    *crc = acp_crc16_finalize(state);
+    return ACP_OK;
+}
+
 /* ========================================================================== */
 /*                           Utility Functions                               */
 /* ========================================================================== */
@@ -185,38 +468,20 @@ int acp_cobs_validate(const uint8_t *data, size_t len)
         return 0;
     }
 
-    size_t pos = 0;
+    /* Neither codes nor block data may be zero: one vector scan covers both */
+    if (acp_scan_zero(data, len) != len)
+    {
+        return 0;
+    }
 
+    /* Walk the code bytes; blocks must tile the data exactly */
+    size_t pos = 0;
     while (pos < len)
     {
-        uint8_t code = data[pos];
-
-        /* Code must be non-zero; upper bound is implicit for uint8_t */
-        if (code == 0)
-        {
-            return 0;
-        }
-
-        size_t block_len = code - 1;
-        pos += 1 + block_len;
-
-        /* Check bounds */
-        if (pos > len)
-        {
-            return 0;
-        }
-
-        /* Verify no zero bytes in block */
-        for (size_t i = pos - block_len; i < pos; i++)
-        {
-            if (data[i] == 0)
-            {
-                return 0;
-            }
-        }
+        pos += data[pos];
     }
 
-    return 1;
+    return pos == len;
 }
 
 /* ========================================================================== */
@@ -306,6 +571,73 @@ int acp_cobs_decoder_feed_byte(acp_cobs_decoder_t *decoder, uint8_t byte)
     }
 }
 
+int acp_cobs_decoder_feed(acp_cobs_decoder_t *decoder,
+                          const uint8_t *data, size_t len,
+                          size_t *consumed)
+{
+    if (!decoder || !consumed || (!data && len > 0))
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    *consumed = 0;
+
+    if (decoder->state == ACP_COBS_DECODER_ERROR)
+    {
+        /* In error state until reset */
+        return decoder->error_code;
+    }
+    if (decoder->state == ACP_COBS_DECODER_COMPLETE)
+    {
+        /* Feeding again releases the previously completed frame */
+        acp_cobs_decoder_reset(decoder);
+    }
+
+    size_t pos = 0;
+    if (decoder->state == ACP_COBS_DECODER_IDLE)
+    {
+        /* Skip delimiters between frames */
+        while (pos < len && data[pos] == ACP_COBS_DELIMITER)
+        {
+            pos++;
+        }
+        if (pos == len)
+        {
+            *consumed = len;
+            return 0;
+        }
+        decoder->state = ACP_COBS_DECODER_RECEIVING;
+    }
+
+    /* Accumulate everything up to the next delimiter in one copy */
+    const uint8_t *start = data + pos;
+    size_t run = acp_scan_zero(start, len - pos);
+    int delim = (run < len - pos);
+
+    if (run > decoder->buffer_size - decoder->buffer_pos)
+    {
+        decoder->state = ACP_COBS_DECODER_ERROR;
+        decoder->error_code = ACP_ERR_BUFFER_TOO_SMALL;
+        *consumed = pos;
+        return ACP_ERR_BUFFER_TOO_SMALL;
+    }
+
+    memcpy(decoder->buffer + decoder->buffer_pos, start, run);
+    decoder->buffer_pos += run;
+    pos += run;
+
+    if (delim)
+    {
+        /* Frame delimiter found - frame complete */
+        decoder->state = ACP_COBS_DECODER_COMPLETE;
+        *consumed = pos + 1;
+        return 1;
+    }
+
+    *consumed = pos;
+    return 0;
+}
+
 int acp_cobs_decoder_get_frame(acp_cobs_decoder_t *decoder,
                                uint8_t *output, size_t output_size,
                                size_t *decoded_len)
@@ -95,6 +95,57 @@ extern "C"
                         uint8_t *output, size_t output_size,
                         size_t *decoded_len);
 
+    /**
+     * @brief Decode one delimited COBS frame and compute its CRC16 in one pass
+     *
+     * Fused receive kernel: scans for the terminating delimiter, un-stuffs
+     * the COBS blocks and updates the CRC16-CCITT block by block in the same
+     * pass, so each input byte is read from memory exactly once. The CRC
+     * covers every decoded byte except the trailing two, which on an ACP
+     * frame hold the received CRC.
+     *
+     * @param input Encoded data starting just after the opening delimiter
+     * @param input_len Length of input data (may extend past the frame)
+     * @param output Output buffer for decoded frame
+     * @param output_size Size of output buffer
+     * @param decoded_len Returns the decoded frame length
+     * @param consumed Returns bytes consumed including the closing delimiter
+     * @param crc Returns CRC16 over the first decoded_len - 2 bytes
+     * @return 0 on success, ACP_ERR_NEED_MORE_DATA if no delimiter was found,
+     *         negative error code on failure
+     */
+    int acp_cobs_decode_crc16(const uint8_t *input, size_t input_len,
+                              uint8_t *output, size_t output_size,
+                              size_t *decoded_len, size_t *consumed,
+                              uint16_t *crc);
+
+    /**
+     * @brief Decode one delimited COBS frame split across two spans
+     *
+     * Same as acp_cobs_decode_crc16(), but the input is the concatenation of
+     * @p head and @p tail, e.g. the two halves of a circular receive buffer
+     * either side of the wrap point. Blocks straddling the seam are copied
+     * out in two pieces; the input is never linearised.
+     *
+     * @param head First span, starting just after the opening delimiter
+     * @param head_len Length of first span
+     * @param tail Second span, continuing the first (may be NULL if empty)
+     * @param tail_len Length of second span
+     * @param output Output buffer for decoded frame
+     * @param output_size Size of output buffer
+     * @param decoded_len Returns the decoded frame length
+     * @param consumed Returns bytes consumed across both spans, including
+     *                 the closing delimiter
+     * @param crc Returns CRC16 over the first decoded_len - 2 bytes
+     * @return 0 on success, ACP_ERR_NEED_MORE_DATA if no delimiter was found,
+     *         negative error code on failure
+     */
+    int acp_cobs_decode_crc16_split(const uint8_t *head, size_t head_len,
+                                    const uint8_t *tail, size_t tail_len,
+                                    uint8_t *output, size_t output_size,
+                                    size_t *decoded_len, size_t *consumed,
+                                    uint16_t *crc);
+
     /**
      * @brief Calculate maximum encoded size for given input length
      *
@@ -123,6 +174,77 @@ extern "C"
      */
     int acp_cobs_validate(const uint8_t *data, size_t len);
 
+    /* ========================================================================== */
+    /*                          Streaming Encoder                                */
+    /* ========================================================================== */
+
+    /**
+     * @brief COBS streaming encoder context
+     *
+     * Stuffs data directly into the caller's output buffer as it is written,
+     * so a frame can be assembled from several pieces without first being
+     * copied into a contiguous staging buffer. Written data may lie in the
+     * output itself, provided it starts far enough ahead of the write
+     * position to stay in front of the code bytes inserted before it.
+     */
+    typedef struct
+    {
+        uint8_t *output;    /**< Output buffer */
+        size_t output_size; /**< Output buffer size */
+        size_t pos;         /**< Next write position in output */
+        size_t code_pos;    /**< Position of the open block's code byte */
+        uint8_t code;       /**< Open block code (data bytes + 1), 0 if none open */
+        int error_code;     /**< Sticky error code */
+    } acp_cobs_encoder_t;
+
+    /**
+     * @brief Initialize COBS streaming encoder
+     *
+     * @param encoder Encoder context to initialize
+     * @param output Output buffer for encoded data
+     * @param output_size Size of output buffer
+     * @return 0 on success, negative error code on failure
+     */
+    int acp_cobs_encoder_init(acp_cobs_encoder_t *encoder,
+                              uint8_t *output, size_t output_size);
+
+    /**
+     * @brief Append data to the COBS stream
+     *
+     * @param encoder Encoder context
+     * @param data Data to encode
+     * @param len Length of data in bytes
+     * @return 0 on success, negative error code on failure (sticky)
+     */
+    int acp_cobs_encoder_write(acp_cobs_encoder_t *encoder,
+                               const uint8_t *data, size_t len);
+
+    /**
+     * @brief Append data to the COBS stream and fold it into a CRC16
+     *
+     * Fused transmit kernel: data is stuffed into the output and folded
+     * into the CRC16-CCITT one block-sized chunk at a time, so each chunk
+     * is read from memory once and reused from L1.
+     *
+     * @param encoder Encoder context
+     * @param data Data to encode
+     * @param len Length of data in bytes
+     * @param crc In: running CRC16 state, Out: updated state
+     * @return 0 on success, negative error code on failure (sticky)
+     */
+    int acp_cobs_encoder_write_crc16(acp_cobs_encoder_t *encoder,
+                                     const uint8_t *data, size_t len,
+                                     uint16_t *crc);
+
+    /**
+     * @brief Close the COBS stream
+     *
+     * @param encoder Encoder context
+     * @param encoded_len Returns the total encoded length
+     * @return 0 on success, negative error code if any write failed
+     */
+    int acp_cobs_encoder_finish(acp_cobs_encoder_t *encoder, size_t *encoded_len);
+
     /* ========================================================================== */
     /*                          Decoder State Machine                            */
     /* ========================================================================== */
@@ -180,6 +302,27 @@ extern "C"
      */
     int acp_cobs_decoder_feed_byte(acp_cobs_decoder_t *decoder, uint8_t byte);
 
+    /**
+     * @brief Feed a chunk of bytes to COBS streaming decoder
+     *
+     * Bulk counterpart of acp_cobs_decoder_feed_byte(): locates the next
+     * delimiter with a single scan and copies the frame bytes in one go.
+     * Processing stops at each frame boundary so that every frame in the
+     * chunk is reported; call again with the remaining bytes after
+     * retrieving the frame. Feeding a decoder in the COMPLETE state releases
+     * the completed frame and starts the next one.
+     *
+     * @param decoder Decoder context
+     * @param data Input bytes (e.g. one read() chunk)
+     * @param len Length of input in bytes
+     * @param consumed Returns bytes processed, including the closing delimiter
+     * @return 1 if a frame completed, 0 if the chunk was exhausted,
+     *         negative on error (decoder must be reset)
+     */
+    int acp_cobs_decoder_feed(acp_cobs_decoder_t *decoder,
+                              const uint8_t *data, size_t len,
+                              size_t *consumed);
+
     /**
      * @brief Get decoded frame from streaming decoder
      *
@@ -174,6 +174,52 @@
 #define ACP_MALLOC
 #endif
 
+/* Cache line size used to keep data written by different cores apart */
+#ifndef ACP_CACHE_LINE_SIZE
+#define ACP_CACHE_LINE_SIZE 64
+#endif
+
+/*
+ * Starts a declaration on its own cache line. Goes before the type, where
+ * MSVC requires __declspec(align). Other compilers get no alignment, and
+ * the sections of acp_ring_t, acp_session_t and acp_session_stripe_t may
+ * then share lines.
+ */
+#if defined(ACP_COMPILER_GCC) || defined(ACP_COMPILER_CLANG)
+#define ACP_CACHE_ALIGNED __attribute__((aligned(ACP_CACHE_LINE_SIZE)))
+#elif defined(ACP_COMPILER_MSVC)
+#define ACP_CACHE_ALIGNED __declspec(align(ACP_CACHE_LINE_SIZE))
+#else
+#define ACP_CACHE_ALIGNED
+#endif
+
+/*
+ * Atomic access to aligned word-sized state shared between threads. Relaxed
+ * accesses are whole but unordered against other memory, which is enough
+ * when every value stored is complete and usable on its own, such as a
+ * kernel pointer installed on first use. An acquire load that sees a
+ * release store also sees the memory written before it, as ring indices
+ * need. MSVC needs 17.9 or later for __typeof__; other compilers are left
+ * without, so code sharing state between threads does not build there.
+ */
+#if defined(ACP_COMPILER_GCC) || defined(ACP_COMPILER_CLANG)
+#define ACP_ATOMIC_LOAD_RELAXED(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define ACP_ATOMIC_STORE_RELAXED(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define ACP_ATOMIC_LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ACP_ATOMIC_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define ACP_ATOMIC_FETCH_ADD_RELAXED(p, v) __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#elif defined(ACP_COMPILER_MSVC)
+#include <intrin.h>
+#define ACP_ATOMIC_LOAD_RELAXED(p) (*(volatile const __typeof__(*(p)) *)(p))
+#define ACP_ATOMIC_STORE_RELAXED(p, v) (*(volatile __typeof__(*(p)) *)(p) = (v))
+/* Under the default /volatile:ms, x86 and x64 volatile accesses already acquire and release */
+#define ACP_ATOMIC_LOAD_ACQUIRE(p) ACP_ATOMIC_LOAD_RELAXED(p)
+#define ACP_ATOMIC_STORE_RELEASE(p, v) ACP_ATOMIC_STORE_RELAXED(p, v)
+/* 64-bit counters only */
+#define ACP_ATOMIC_FETCH_ADD_RELAXED(p, v) \
+    ((uint64_t)_InterlockedExchangeAdd64((volatile __int64 *)(p), (__int64)(v)))
+#endif
+
 /* Configuration validation */
 #if !defined(ACP_HAVE_C99)
 #error "ACP requires C99 or later"
@@ -0,0 +1,131 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_cpu.c
+ * @brief Runtime CPU feature detection for ACP kernel dispatch
+ *
+ * @version 0.3.0
+ * @date 2025-10-27
+ */
+
+#include "acp_cpu.h"
+
+#ifdef ACP_HAVE_X86_KERNELS
+#include <cpuid.h>
+#endif
+
+/* ========================================================================== */
+/*                              Detection State                               */
+/* ========================================================================== */
+
+/*
+ * Any thread may run detection first, so the state is accessed with relaxed
+ * atomics; detection is idempotent, so a race only repeats it.
+ */
+
+/** @brief Set in cpu_features_detected once detection has run */
+#define CPU_FEATURES_VALID 0x80000000u
+
+/** @brief Detected features, plus CPU_FEATURES_VALID once detected */
+static uint32_t cpu_features_detected = 0;
+
+/** @brief Features allowed by acp_cpu_set_feature_mask() */
+static uint32_t cpu_feature_mask = ~0u;
+
+/* ========================================================================== */
+/*                              Detection                                     */
+/* ========================================================================== */
+
+#ifdef ACP_HAVE_X86_KERNELS
+/**
+ * @brief Check the OS saves XMM and YMM state across context switches
+ */
+static int cpu_os_supports_avx(void)
+{
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (eax & 0x6u) == 0x6u;
+}
+#endif
+
+/**
+ * @brief Query the processor for supported instruction set extensions
+ */
+static uint32_t cpu_detect(void)
+{
+    uint32_t features = 0;
+
+#ifdef ACP_HAVE_X86_KERNELS
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return 0;
+    }
+
+    if (edx & bit_SSE2)
+        features |= ACP_CPU_SSE2;
+    if (ecx & bit_SSSE3)
+        features |= ACP_CPU_SSSE3;
+    if (ecx & bit_SSE4_1)
+        features |= ACP_CPU_SSE41;
+    if (ecx & bit_PCLMUL)
+        features |= ACP_CPU_PCLMUL;
+
+    int os_avx = (ecx & bit_OSXSAVE) && (ecx & bit_AVX) && cpu_os_supports_avx();
+
+    if (__get_cpuid_max(0, 0) >= 7)
+    {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if (os_avx && (ebx & bit_AVX2))
+            features |= ACP_CPU_AVX2;
+        if (ebx & bit_SHA)
+            features |= ACP_CPU_SHA;
+    }
+#endif
+
+#ifdef ACP_HAVE_NEON_KERNELS
+    features |= ACP_CPU_NEON;
+#endif
+
+    return features;
+}
+
+/* ========================================================================== */
+/*                              Public API                                    */
+/* ========================================================================== */
+
+uint32_t acp_cpu_features(void)
+{
+    uint32_t detected = ACP_ATOMIC_LOAD_RELAXED(&cpu_features_detected);
+    if (!(detected & CPU_FEATURES_VALID))
+    {
+        detected = cpu_detect() | CPU_FEATURES_VALID;
+        ACP_ATOMIC_STORE_RELAXED(&cpu_features_detected, detected);
+    }
+    return detected & ACP_ATOMIC_LOAD_RELAXED(&cpu_feature_mask) & ~CPU_FEATURES_VALID;
+}
+
+void acp_cpu_set_feature_mask(uint32_t mask)
+{
+    ACP_ATOMIC_STORE_RELAXED(&cpu_feature_mask, mask);
+}
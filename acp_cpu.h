@@ -0,0 +1,97 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_cpu.h
+ * @brief Runtime CPU feature detection for ACP kernel dispatch
+ *
+ * Accelerated kernels (scanning, CRC, hashing) are compiled alongside their
+ * portable versions and selected at runtime from the features reported
+ * here, so one binary runs on any CPU of the target architecture.
+ *
+ * @version 0.3.0
+ * @date 2025-10-27
+ */
+
+#ifndef ACP_CPU_H
+#define ACP_CPU_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "acp_config.h"
+
+/* ========================================================================== */
+/*                              Feature Flags                                 */
+/* ========================================================================== */
+
+#define ACP_CPU_SSE2 0x0001u   /**< x86 SSE2 */
+#define ACP_CPU_SSSE3 0x0002u  /**< x86 SSSE3 */
+#define ACP_CPU_SSE41 0x0004u  /**< x86 SSE4.1 */
+#define ACP_CPU_AVX2 0x0008u   /**< x86 AVX2 (with OS YMM state support) */
+#define ACP_CPU_PCLMUL 0x0010u /**< x86 carry-less multiply */
+#define ACP_CPU_SHA 0x0020u    /**< x86 SHA extensions */
+#define ACP_CPU_NEON 0x0100u   /**< ARM Advanced SIMD */
+
+/* x86 intrinsics kernels need GCC/Clang target attributes */
+#if (defined(ACP_ARCH_X86_64) || defined(ACP_ARCH_X86)) && defined(ACP_COMPILER_GCC)
+#define ACP_HAVE_X86_KERNELS 1
+#endif
+
+/* NEON is part of the AArch64 baseline */
+#if defined(ACP_ARCH_ARM64) && defined(__ARM_NEON)
+#define ACP_HAVE_NEON_KERNELS 1
+#endif
+
+    /* ========================================================================== */
+    /*                              Functions                                     */
+    /* ========================================================================== */
+
+    /**
+     * @brief Get the CPU features usable by ACP kernels
+     *
+     * Detected once and cached; the result is masked by
+     * acp_cpu_set_feature_mask().
+     *
+     * @return Bitmask of ACP_CPU_* flags
+     */
+    uint32_t acp_cpu_features(void);
+
+    /**
+     * @brief Restrict the features reported by acp_cpu_features()
+     *
+     * Intended for tests and benchmarks that need to exercise fallback
+     * kernels on capable hardware. Takes effect for dispatchers resolved
+     * afterwards.
+     *
+     * @param mask Bitmask of ACP_CPU_* flags to allow (~0u for all)
+     */
+    void acp_cpu_set_feature_mask(uint32_t mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACP_CPU_H */
@@ -145,7 +145,7 @@ extern "C"
      * @brief Get CRC16 lookup table
      *
      * Returns pointer to the 256-entry CRC16 lookup table for table-based
-     * implementations. The table is computed at compile time or runtime.
+     * implementations. The table is a compile-time constant.
      *
      * @return Pointer to CRC16 lookup table (256 entries)
      */
@@ -154,13 +154,53 @@ extern "C"
     /**
      * @brief Initialize CRC16 lookup table
      *
-     * Initializes the CRC16 lookup table. Called automatically by other
-     * CRC functions, but can be called explicitly for performance.
-     *
-     * This function is thread-safe and idempotent.
+     * The lookup tables are compile-time constants, so this is a no-op kept
+     * for API compatibility. It is thread-safe and idempotent.
      */
     void acp_crc16_init_table(void);
 
+    /* ========================================================================== */
+    /*                              Kernel Selection                              */
+    /* ========================================================================== */
+
+    /**
+     * @brief CRC16 kernels used by acp_crc16_update() for long buffers
+     */
+    typedef enum
+    {
+        ACP_CRC16_KERNEL_AUTO = 0, /**< Best kernel for the running CPU */
+        ACP_CRC16_KERNEL_TABLE,    /**< Portable slice-by-8 tables */
+        ACP_CRC16_KERNEL_CLMUL,    /**< x86 PCLMULQDQ folding */
+        ACP_CRC16_KERNEL_COUNT
+    } acp_crc16_kernel_t;
+
+    /**
+     * @brief Select the CRC16 kernel
+     *
+     * The kernel is otherwise chosen on first use from the CPU features.
+     * Short buffers always use the table kernel.
+     *
+     * @param kernel Kernel to use (ACP_CRC16_KERNEL_AUTO for runtime detection)
+     * @return 0 on success, ACP_ERR_NOT_IMPLEMENTED if the kernel is not
+     *         available on this build or CPU
+     */
+    int acp_crc16_set_kernel(acp_crc16_kernel_t kernel);
+
+    /**
+     * @brief Get the active CRC16 kernel
+     *
+     * @return Active kernel (never ACP_CRC16_KERNEL_AUTO)
+     */
+    acp_crc16_kernel_t acp_crc16_get_kernel(void);
+
+    /**
+     * @brief Get a printable kernel name
+     *
+     * @param kernel Kernel identifier
+     * @return Static name string
+     */
+    const char *acp_crc16_kernel_name(acp_crc16_kernel_t kernel);
+
     /* ========================================================================== */
     /*                              Test Vectors                                 */
     /* ========================================================================== */
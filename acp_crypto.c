@@ -32,8 +32,14 @@
  */
 
 #include "acp_crypto.h"
+#include "acp_cpu.h"
+#include "acp_errors.h"
 #include <string.h>
 
+#ifdef ACP_HAVE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 /* ========================================================================== */
 /*                              SHA-256 Implementation                        */
 /* ========================================================================== */
@@ -56,8 +62,8 @@ static const uint32_t H0[8] = {
 
 /* SHA-256 helper macros */
 #define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
-#define CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
-#define MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define CH(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
 #define EP0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
 #define EP1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
 #define SIG0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
@@ -78,64 +84,249 @@ void acp_sha256_init(acp_sha256_ctx_t *ctx)
 }
 
 /**
- * @brief Process a single 512-bit block
+ * @brief Load a big-endian 32-bit word (compiles to a load and byte swap)
+ */
+static inline uint32_t sha256_load_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/*
+ * One round without moving the working variables: the caller rotates the
+ * argument order instead, so each round only updates d and h.
+ */
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i, wi)          \
+    do                                                      \
+    {                                                       \
+        uint32_t t1_ = (h) + EP1(e) + CH(e, f, g) + K[i] + (wi); \
+        (d) += t1_;                                         \
+        (h) = t1_ + EP0(a) + MAJ(a, b, c);                  \
+    } while (0)
+
+/* Message word i: loaded for rounds 0-15, then expanded in a 16-word ring */
+#define SHA256_W_LOAD(i) (w[i] = sha256_load_be32(data + 4 * (i)))
+#define SHA256_W_EXPAND(i) \
+    (w[(i) & 15] += SIG1(w[((i) - 2) & 15]) + w[((i) - 7) & 15] + SIG0(w[((i) - 15) & 15]))
+
+#define SHA256_ROUNDS_8(i, W)                           \
+    do                                                  \
+    {                                                   \
+        SHA256_ROUND(a, b, c, d, e, f, g, h, (i) + 0, W((i) + 0)); \
+        SHA256_ROUND(h, a, b, c, d, e, f, g, (i) + 1, W((i) + 1)); \
+        SHA256_ROUND(g, h, a, b, c, d, e, f, (i) + 2, W((i) + 2)); \
+        SHA256_ROUND(f, g, h, a, b, c, d, e, (i) + 3, W((i) + 3)); \
+        SHA256_ROUND(e, f, g, h, a, b, c, d, (i) + 4, W((i) + 4)); \
+        SHA256_ROUND(d, e, f, g, h, a, b, c, (i) + 5, W((i) + 5)); \
+        SHA256_ROUND(c, d, e, f, g, h, a, b, (i) + 6, W((i) + 6)); \
+        SHA256_ROUND(b, c, d, e, f, g, h, a, (i) + 7, W((i) + 7)); \
+    } while (0)
+
+/**
+ * @brief Scalar kernel: process consecutive 512-bit blocks
+ *
+ * Portable core for targets without SHA instructions: the 64 rounds are
+ * fully unrolled, the message schedule is a 16-word ring expanded one
+ * word ahead of its round, and the chaining state stays in locals across
+ * all blocks of a call.
  */
-static void acp_sha256_process_block(acp_sha256_ctx_t *ctx, const uint8_t *data)
+static void sha256_compress_scalar(uint32_t state[8], const uint8_t *data, size_t nblocks)
 {
-    uint32_t w[64];
-    uint32_t a, b, c, d, e, f, g, h;
-    uint32_t t1, t2;
-    int i;
+    uint32_t s0 = state[0], s1 = state[1], s2 = state[2], s3 = state[3];
+    uint32_t s4 = state[4], s5 = state[5], s6 = state[6], s7 = state[7];
+    uint32_t w[16];
 
-    /* Prepare the message schedule */
-    for (i = 0; i < 16; i++)
+    for (; nblocks > 0; nblocks--, data += ACP_SHA256_BLOCK_SIZE)
     {
-        w[i] = ((uint32_t)data[i * 4] << 24) |
-               ((uint32_t)data[i * 4 + 1] << 16) |
-               ((uint32_t)data[i * 4 + 2] << 8) |
-               ((uint32_t)data[i * 4 + 3]);
+        uint32_t a = s0, b = s1, c = s2, d = s3;
+        uint32_t e = s4, f = s5, g = s6, h = s7;
+
+        SHA256_ROUNDS_8(0, SHA256_W_LOAD);
+        SHA256_ROUNDS_8(8, SHA256_W_LOAD);
+        SHA256_ROUNDS_8(16, SHA256_W_EXPAND);
+        SHA256_ROUNDS_8(24, SHA256_W_EXPAND);
+        SHA256_ROUNDS_8(32, SHA256_W_EXPAND);
+        SHA256_ROUNDS_8(40, SHA256_W_EXPAND);
+        SHA256_ROUNDS_8(48, SHA256_W_EXPAND);
+        SHA256_ROUNDS_8(56, SHA256_W_EXPAND);
+
+        s0 += a;
+        s1 += b;
+        s2 += c;
+        s3 += d;
+        s4 += e;
+        s5 += f;
+        s6 += g;
+        s7 += h;
     }
 
-    for (i = 16; i < 64; i++)
+    state[0] = s0;
+    state[1] = s1;
+    state[2] = s2;
+    state[3] = s3;
+    state[4] = s4;
+    state[5] = s5;
+    state[6] = s6;
+    state[7] = s7;
+}
+
+#undef SHA256_ROUNDS_8
+#undef SHA256_W_EXPAND
+#undef SHA256_W_LOAD
+#undef SHA256_ROUND
+
+#ifdef ACP_HAVE_X86_KERNELS
+
+/*
+ * Four rounds with the SHA extensions. cur holds message words 4i..4i+3;
+ * the schedule for later groups is advanced in place (MSG1 on prev, MSG2
+ * into next) so only four message registers are live.
+ */
+#define SHA256_NI_QUAD(i, cur, prev, next)                                                  \
+    do                                                                                      \
+    {                                                                                       \
+        __m128i msg = _mm_add_epi32(cur, _mm_loadu_si128((const __m128i *)&K[4 * (i)]));    \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);                                \
+        if ((i) >= 3 && (i) <= 14)                                                          \
+        {                                                                                   \
+            next = _mm_add_epi32(next, _mm_alignr_epi8(cur, prev, 4));                      \
+            next = _mm_sha256msg2_epu32(next, cur);                                         \
+        }                                                                                   \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));       \
+        if ((i) >= 1 && (i) <= 12)                                                          \
+        {                                                                                   \
+            prev = _mm_sha256msg1_epu32(prev, cur);                                         \
+        }                                                                                   \
+    } while (0)
+
+/**
+ * @brief SHA-NI kernel: SHA256RNDS2/MSG1/MSG2 compression
+ *
+ * The instructions operate on the state split as ABEF/CDGH, so the state
+ * is permuted once on entry and back on exit rather than per block.
+ */
+__attribute__((target("sha,sse4.1"))) static void sha256_compress_shani(uint32_t state[8], const uint8_t *data, size_t nblocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1); /* CDAB */
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B); /* EFGH */
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);                                    /* ABEF */
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);                                         /* CDGH */
+
+    for (; nblocks > 0; nblocks--, data += ACP_SHA256_BLOCK_SIZE)
     {
-        w[i] = SIG1(w[i - 2]) + w[i - 7] + SIG0(w[i - 15]) + w[i - 16];
+        __m128i abef_save = state0;
+        __m128i cdgh_save = state1;
+
+        __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), bswap);
+        __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), bswap);
+        __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), bswap);
+        __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), bswap);
+
+        SHA256_NI_QUAD(0, m0, m3, m1);
+        SHA256_NI_QUAD(1, m1, m0, m2);
+        SHA256_NI_QUAD(2, m2, m1, m3);
+        SHA256_NI_QUAD(3, m3, m2, m0);
+        SHA256_NI_QUAD(4, m0, m3, m1);
+        SHA256_NI_QUAD(5, m1, m0, m2);
+        SHA256_NI_QUAD(6, m2, m1, m3);
+        SHA256_NI_QUAD(7, m3, m2, m0);
+        SHA256_NI_QUAD(8, m0, m3, m1);
+        SHA256_NI_QUAD(9, m1, m0, m2);
+        SHA256_NI_QUAD(10, m2, m1, m3);
+        SHA256_NI_QUAD(11, m3, m2, m0);
+        SHA256_NI_QUAD(12, m0, m3, m1);
+        SHA256_NI_QUAD(13, m1, m0, m2);
+        SHA256_NI_QUAD(14, m2, m1, m3);
+        SHA256_NI_QUAD(15, m3, m2, m0);
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
     }
 
-    /* Initialize working variables */
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
-    f = ctx->state[5];
-    g = ctx->state[6];
-    h = ctx->state[7];
-
-    /* Compression function main loop */
-    for (i = 0; i < 64; i++)
+    tmp = _mm_shuffle_epi32(state0, 0x1B);        /* FEBA */
+    state1 = _mm_shuffle_epi32(state1, 0xB1);     /* DCHG */
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);  /* DCBA */
+    state1 = _mm_alignr_epi8(state1, tmp, 8);     /* HGFE */
+
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#undef SHA256_NI_QUAD
+
+#endif /* ACP_HAVE_X86_KERNELS */
+
+/* ========================================================================== */
+/*                              Kernel Dispatch                               */
+/* ========================================================================== */
+
+typedef void (*sha256_compress_fn_t)(uint32_t state[8], const uint8_t *data, size_t nblocks);
+
+static void sha256_compress_resolve(uint32_t state[8], const uint8_t *data, size_t nblocks);
+
+/** @brief Active compression kernel; starts at a resolver that installs the best one */
+static sha256_compress_fn_t sha256_compress = sha256_compress_resolve;
+static acp_sha256_kernel_t sha256_kernel = ACP_SHA256_KERNEL_AUTO;
+
+/**
+ * @brief Kernel entry point if compiled in and supported by the CPU
+ */
+static sha256_compress_fn_t sha256_kernel_fn(acp_sha256_kernel_t kernel)
+{
+    switch (kernel)
     {
-        t1 = h + EP1(e) + CH(e, f, g) + K[i] + w[i];
-        t2 = EP0(a) + MAJ(a, b, c);
+    case ACP_SHA256_KERNEL_SCALAR:
+        return sha256_compress_scalar;
+#ifdef ACP_HAVE_X86_KERNELS
+    case ACP_SHA256_KERNEL_SHANI:
+    {
+        uint32_t needed = ACP_CPU_SHA | ACP_CPU_SSE41 | ACP_CPU_SSSE3;
+        return ((acp_cpu_features() & needed) == needed) ? sha256_compress_shani : NULL;
+    }
+#endif
+    default:
+        return NULL;
+    }
+}
 
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
+static void sha256_compress_resolve(uint32_t state[8], const uint8_t *data, size_t nblocks)
+{
+    acp_sha256_set_kernel(ACP_SHA256_KERNEL_AUTO);
+    ACP_ATOMIC_LOAD_RELAXED(&sha256_compress)(state, data, nblocks);
+}
+
+int acp_sha256_set_kernel(acp_sha256_kernel_t kernel)
+{
+    if (kernel == ACP_SHA256_KERNEL_AUTO)
+    {
+        kernel = sha256_kernel_fn(ACP_SHA256_KERNEL_SHANI) ? ACP_SHA256_KERNEL_SHANI : ACP_SHA256_KERNEL_SCALAR;
     }
 
-    /* Add the compressed chunk to the current hash value */
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
+    sha256_compress_fn_t fn = sha256_kernel_fn(kernel);
+    if (fn == NULL)
+    {
+        return ACP_ERR_NOT_IMPLEMENTED;
+    }
+
+    ACP_ATOMIC_STORE_RELAXED(&sha256_kernel, kernel);
+    ACP_ATOMIC_STORE_RELAXED(&sha256_compress, fn);
+    return ACP_OK;
+}
+
+acp_sha256_kernel_t acp_sha256_get_kernel(void)
+{
+    if (ACP_ATOMIC_LOAD_RELAXED(&sha256_kernel) == ACP_SHA256_KERNEL_AUTO)
+    {
+        acp_sha256_set_kernel(ACP_SHA256_KERNEL_AUTO);
+    }
+    return ACP_ATOMIC_LOAD_RELAXED(&sha256_kernel);
+}
+
+const char *acp_sha256_kernel_name(acp_sha256_kernel_t kernel)
+{
+    static const char *const names[ACP_SHA256_KERNEL_COUNT] = {"auto", "scalar", "sha-ni"};
+    return (kernel < ACP_SHA256_KERNEL_COUNT) ? names[kernel] : "unknown";
 }
 
 /**
@@ -148,32 +339,39 @@ void acp_sha256_update(acp_sha256_ctx_t *ctx, const uint8_t *data, size_t len)
 
     size_t i = 0;
 
-    /* Process data byte by byte if buffer is partially filled */
-    while (i < len && ctx->buffer_len > 0 && ctx->buffer_len < ACP_SHA256_BLOCK_SIZE)
+    /* Top up a partially filled buffer first */
+    if (ctx->buffer_len > 0)
     {
-        ctx->buffer[ctx->buffer_len++] = data[i++];
+        i = ACP_SHA256_BLOCK_SIZE - ctx->buffer_len;
+        if (i > len)
+        {
+            i = len;
+        }
+        memcpy(ctx->buffer + ctx->buffer_len, data, i);
+        ctx->buffer_len += i;
 
-        if (ctx->buffer_len == ACP_SHA256_BLOCK_SIZE)
+        if (ctx->buffer_len < ACP_SHA256_BLOCK_SIZE)
         {
-            acp_sha256_process_block(ctx, ctx->buffer);
-            ctx->buffer_len = 0;
-            ctx->bit_len += 512;
+            return;
         }
+
+        ACP_ATOMIC_LOAD_RELAXED(&sha256_compress)(ctx->state, ctx->buffer, 1);
+        ctx->buffer_len = 0;
+        ctx->bit_len += 512;
     }
 
     /* Process complete blocks directly */
-    while (i + ACP_SHA256_BLOCK_SIZE <= len)
+    size_t nblocks = (len - i) / ACP_SHA256_BLOCK_SIZE;
+    if (nblocks > 0)
     {
-        acp_sha256_process_block(ctx, &data[i]);
-        i += ACP_SHA256_BLOCK_SIZE;
-        ctx->bit_len += 512;
+        ACP_ATOMIC_LOAD_RELAXED(&sha256_compress)(ctx->state, &data[i], nblocks);
+        i += nblocks * ACP_SHA256_BLOCK_SIZE;
+        ctx->bit_len += (uint64_t)nblocks * 512;
     }
 
     /* Buffer remaining bytes */
-    while (i < len)
-    {
-        ctx->buffer[ctx->buffer_len++] = data[i++];
-    }
+    memcpy(ctx->buffer, &data[i], len - i);
+    ctx->buffer_len = len - i;
 }
 
 /**
@@ -193,19 +391,13 @@ void acp_sha256_final(acp_sha256_ctx_t *ctx, uint8_t *hash)
     /* If we don't have room for the length, pad to end and process */
     if (ctx->buffer_len > 56)
     {
-        while (ctx->buffer_len < ACP_SHA256_BLOCK_SIZE)
-        {
-            ctx->buffer[ctx->buffer_len++] = 0x00;
-        }
-        acp_sha256_process_block(ctx, ctx->buffer);
+        memset(ctx->buffer + ctx->buffer_len, 0, ACP_SHA256_BLOCK_SIZE - ctx->buffer_len);
+        ACP_ATOMIC_LOAD_RELAXED(&sha256_compress)(ctx->state, ctx->buffer, 1);
         ctx->buffer_len = 0;
     }
 
     /* Pad to 56 bytes */
-    while (ctx->buffer_len < 56)
-    {
-        ctx->buffer[ctx->buffer_len++] = 0x00;
-    }
+    memset(ctx->buffer + ctx->buffer_len, 0, 56 - ctx->buffer_len);
 
     /* Append length in bits as big-endian 64-bit number */
     for (i = 0; i < 8; i++)
@@ -213,7 +405,7 @@ void acp_sha256_final(acp_sha256_ctx_t *ctx, uint8_t *hash)
         ctx->buffer[56 + i] = (uint8_t)(bit_len >> (56 - i * 8));
     }
 
-    acp_sha256_process_block(ctx, ctx->buffer);
+    ACP_ATOMIC_LOAD_RELAXED(&sha256_compress)(ctx->state, ctx->buffer, 1);
 
     /* Output hash in big-endian format */
     for (i = 0; i < 8; i++)
@@ -243,16 +435,15 @@ void acp_sha256(const uint8_t *data, size_t len, uint8_t *hash)
 /*                              HMAC-SHA256 Implementation                    */
 /* ========================================================================== */
 
-void acp_hmac_sha256(const uint8_t *key, size_t key_len,
-                     const uint8_t *data, size_t data_len,
-                     uint8_t *mac)
+/**
+ * @brief Initialize HMAC-SHA256 context with a key
+ */
+void acp_hmac_init(acp_hmac_ctx_t *ctx, const uint8_t *key, size_t key_len)
 {
     uint8_t k_pad[ACP_SHA256_BLOCK_SIZE];
-    uint8_t inner_hash[ACP_SHA256_SIZE];
-    acp_sha256_ctx_t ctx;
     size_t i;
 
-    if (!key || !data || !mac)
+    if (!ctx || (!key && key_len > 0))
         return;
 
     /* Prepare the key */
@@ -263,43 +454,493 @@ void acp_hmac_sha256(const uint8_t *key, size_t key_len,
         /* Hash the key if it's too long */
         acp_sha256(key, key_len, k_pad);
     }
-    else
+    else if (key_len > 0)
     {
         /* Use key directly, zero-padded */
         memcpy(k_pad, key, key_len);
     }
 
-    /* Create inner padding (key XOR ipad) */
+    /* Inner context absorbs (key XOR ipad) */
     for (i = 0; i < ACP_SHA256_BLOCK_SIZE; i++)
     {
         k_pad[i] ^= 0x36;
     }
+    acp_sha256_init(&ctx->inner);
+    acp_sha256_update(&ctx->inner, k_pad, ACP_SHA256_BLOCK_SIZE);
 
-    /* Inner hash: SHA256(K XOR ipad || text) */
-    acp_sha256_init(&ctx);
-    acp_sha256_update(&ctx, k_pad, ACP_SHA256_BLOCK_SIZE);
-    acp_sha256_update(&ctx, data, data_len);
-    acp_sha256_final(&ctx, inner_hash);
-
-    /* Restore key and create outer padding (key XOR opad) */
+    /* Outer context absorbs (key XOR opad) */
     for (i = 0; i < ACP_SHA256_BLOCK_SIZE; i++)
     {
-        k_pad[i] ^= 0x36; /* Remove ipad */
-        k_pad[i] ^= 0x5c; /* Add opad */
+        k_pad[i] ^= 0x36 ^ 0x5c;
     }
+    acp_sha256_init(&ctx->outer);
+    acp_sha256_update(&ctx->outer, k_pad, ACP_SHA256_BLOCK_SIZE);
+
+    /* Clear sensitive data */
+    acp_crypto_clear(k_pad, sizeof(k_pad));
+}
+
+/**
+ * @brief Initialize HMAC-SHA256 context from precomputed midstates
+ */
+void acp_hmac_init_midstate(acp_hmac_ctx_t *ctx, const acp_hmac_midstate_t *midstate)
+{
+    if (!ctx || !midstate)
+        return;
+
+    /* Each context has absorbed exactly one block; buffers start empty */
+    memcpy(ctx->inner.state, midstate->inner, sizeof(midstate->inner));
+    ctx->inner.bit_len = ACP_SHA256_BLOCK_SIZE * 8;
+    ctx->inner.buffer_len = 0;
+
+    memcpy(ctx->outer.state, midstate->outer, sizeof(midstate->outer));
+    ctx->outer.bit_len = ACP_SHA256_BLOCK_SIZE * 8;
+    ctx->outer.buffer_len = 0;
+}
+
+/**
+ * @brief Update HMAC-SHA256 with additional data
+ */
+void acp_hmac_update(acp_hmac_ctx_t *ctx, const uint8_t *data, size_t len)
+{
+    if (!ctx)
+        return;
+
+    acp_sha256_update(&ctx->inner, data, len);
+}
+
+/**
+ * @brief Finalize HMAC-SHA256 and output the tag
+ */
+void acp_hmac_final(acp_hmac_ctx_t *ctx, uint8_t *mac, int truncated)
+{
+    uint8_t inner_hash[ACP_SHA256_SIZE];
+    uint8_t full_mac[ACP_HMAC_FULL_SIZE];
+
+    if (!ctx || !mac)
+        return;
+
+    /* Inner hash: SHA256(K XOR ipad || text) */
+    acp_sha256_final(&ctx->inner, inner_hash);
 
     /* Outer hash: SHA256(K XOR opad || inner_hash) */
-    acp_sha256_init(&ctx);
-    acp_sha256_update(&ctx, k_pad, ACP_SHA256_BLOCK_SIZE);
-    acp_sha256_update(&ctx, inner_hash, ACP_SHA256_SIZE);
-    acp_sha256_final(&ctx, mac); /* Output full 32-byte HMAC to mac buffer */
+    acp_sha256_update(&ctx->outer, inner_hash, ACP_SHA256_SIZE);
+    acp_sha256_final(&ctx->outer, full_mac);
+
+    memcpy(mac, full_mac, truncated ? ACP_HMAC_SIZE : ACP_HMAC_FULL_SIZE);
 
     /* Clear sensitive data */
-    acp_crypto_clear(k_pad, sizeof(k_pad));
     acp_crypto_clear(inner_hash, sizeof(inner_hash));
+    acp_crypto_clear(full_mac, sizeof(full_mac));
+    acp_crypto_clear(ctx, sizeof(*ctx));
+}
+
+/**
+ * @brief Precompute HMAC-SHA256 midstates for a key
+ */
+void acp_hmac_midstate_init(acp_hmac_midstate_t *midstate, const uint8_t *key, size_t key_len)
+{
+    acp_hmac_ctx_t ctx;
+
+    if (!midstate)
+        return;
+
+    acp_hmac_init(&ctx, key, key_len);
+    memcpy(midstate->inner, ctx.inner.state, sizeof(midstate->inner));
+    memcpy(midstate->outer, ctx.outer.state, sizeof(midstate->outer));
+
+    /* Clear sensitive data */
     acp_crypto_clear(&ctx, sizeof(ctx));
 }
 
+void acp_hmac_sha256_midstate(const acp_hmac_midstate_t *midstate,
+                              const uint8_t *data, size_t data_len,
+                              uint8_t *mac)
+{
+    acp_hmac_ctx_t ctx;
+
+    if (!midstate || !data || !mac)
+        return;
+
+    acp_hmac_init_midstate(&ctx, midstate);
+    acp_hmac_update(&ctx, data, data_len);
+    acp_hmac_final(&ctx, mac, 1);
+}
+
+void acp_hmac_sha256(const uint8_t *key, size_t key_len,
+                     const uint8_t *data, size_t data_len,
+                     uint8_t *mac)
+{
+    acp_hmac_ctx_t ctx;
+
+    if (!key || !data || !mac)
+        return;
+
+    acp_hmac_init(&ctx, key, key_len);
+    acp_hmac_update(&ctx, data, data_len);
+    acp_hmac_final(&ctx, mac, 0); /* Output full 32-byte HMAC to mac buffer */
+}
+
+/* ========================================================================== */
+/*                          Batch HMAC Verification                           */
+/* ========================================================================== */
+
+/** @brief Number of messages hashed side by side by the multi-buffer kernel */
+#define SHA256_LANES 8
+
+/** @brief Mean frame length from which a serial SHA-NI loop beats the AVX2 lanes */
+#define HMAC_BATCH_SERIAL_MIN_LEN 256
+
+/**
+ * @brief Per-lane progress through one HMAC computation
+ *
+ * A lane first streams the frame's whole blocks straight from the caller's
+ * buffer, then its padded tail from pad[]. After the inner hash the same
+ * lane is reloaded with the single outer block.
+ */
+typedef struct
+{
+    const uint8_t *data;  /**< Next whole block in the caller's buffer */
+    size_t data_blocks;   /**< Whole blocks left in data */
+    size_t pad_blocks;    /**< Padded tail blocks left in pad */
+    size_t pad_pos;       /**< Offset of the next tail block */
+    size_t item;          /**< Batch index of the frame in this lane */
+    int outer;            /**< Set once the lane runs the outer hash */
+    uint8_t pad[2 * ACP_SHA256_BLOCK_SIZE]; /**< Padded tail blocks */
+} sha256_lane_t;
+
+/**
+ * @brief Load the padded tail of a message into a lane
+ *
+ * @param lane Lane to fill
+ * @param tail Final partial block of the message
+ * @param tail_len Length of tail (< 64)
+ * @param total_len Message length in bytes, including the key block
+ */
+static void sha256_lane_pad(sha256_lane_t *lane, const uint8_t *tail, size_t tail_len, uint64_t total_len)
+{
+    size_t blocks = (tail_len + 9 <= ACP_SHA256_BLOCK_SIZE) ? 1 : 2;
+    size_t end = blocks * ACP_SHA256_BLOCK_SIZE;
+    uint64_t bit_len = total_len * 8;
+
+    memcpy(lane->pad, tail, tail_len);
+    lane->pad[tail_len] = 0x80;
+    memset(lane->pad + tail_len + 1, 0, end - tail_len - 1 - 8);
+    for (size_t i = 0; i < 8; i++)
+    {
+        lane->pad[end - 8 + i] = (uint8_t)(bit_len >> (56 - i * 8));
+    }
+
+    lane->pad_blocks = blocks;
+    lane->pad_pos = 0;
+}
+
+#ifdef ACP_HAVE_X86_KERNELS
+
+#define SHA256_X8_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+
+/**
+ * @brief AVX2 kernel: compress one block in each of eight lanes
+ *
+ * State is kept transposed, state[word][lane], so each SHA-256 working
+ * variable is one vector. Message words are loaded eight bytes wide per
+ * lane and transposed in registers.
+ */
+__attribute__((target("avx2"))) static void sha256_compress_avx2_x8(uint32_t state[8][SHA256_LANES],
+                                                                   const uint8_t *const blocks[SHA256_LANES])
+{
+    const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                          12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    __m256i w[16];
+
+    for (int half = 0; half < 2; half++)
+    {
+        __m256i r[8], t[8], u[8];
+        for (int l = 0; l < SHA256_LANES; l++)
+        {
+            r[l] = _mm256_loadu_si256((const __m256i *)(blocks[l] + half * 32));
+        }
+
+        t[0] = _mm256_unpacklo_epi32(r[0], r[1]);
+        t[1] = _mm256_unpackhi_epi32(r[0], r[1]);
+        t[2] = _mm256_unpacklo_epi32(r[2], r[3]);
+        t[3] = _mm256_unpackhi_epi32(r[2], r[3]);
+        t[4] = _mm256_unpacklo_epi32(r[4], r[5]);
+        t[5] = _mm256_unpackhi_epi32(r[4], r[5]);
+        t[6] = _mm256_unpacklo_epi32(r[6], r[7]);
+        t[7] = _mm256_unpackhi_epi32(r[6], r[7]);
+
+        u[0] = _mm256_unpacklo_epi64(t[0], t[2]);
+        u[1] = _mm256_unpackhi_epi64(t[0], t[2]);
+        u[2] = _mm256_unpacklo_epi64(t[1], t[3]);
+        u[3] = _mm256_unpackhi_epi64(t[1], t[3]);
+        u[4] = _mm256_unpacklo_epi64(t[4], t[6]);
+        u[5] = _mm256_unpackhi_epi64(t[4], t[6]);
+        u[6] = _mm256_unpacklo_epi64(t[5], t[7]);
+        u[7] = _mm256_unpackhi_epi64(t[5], t[7]);
+
+        for (int k = 0; k < 4; k++)
+        {
+            w[half * 8 + k] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[k], u[k + 4], 0x20), bswap);
+            w[half * 8 + k + 4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[k], u[k + 4], 0x31), bswap);
+        }
+    }
+
+    __m256i a = _mm256_loadu_si256((const __m256i *)state[0]);
+    __m256i b = _mm256_loadu_si256((const __m256i *)state[1]);
+    __m256i c = _mm256_loadu_si256((const __m256i *)state[2]);
+    __m256i d = _mm256_loadu_si256((const __m256i *)state[3]);
+    __m256i e = _mm256_loadu_si256((const __m256i *)state[4]);
+    __m256i f = _mm256_loadu_si256((const __m256i *)state[5]);
+    __m256i g = _mm256_loadu_si256((const __m256i *)state[6]);
+    __m256i h = _mm256_loadu_si256((const __m256i *)state[7]);
+
+    for (int i = 0; i < 64; i++)
+    {
+        if (i >= 16)
+        {
+            __m256i w15 = w[(i - 15) & 15];
+            __m256i w2 = w[(i - 2) & 15];
+            __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(SHA256_X8_ROTR(w15, 7), SHA256_X8_ROTR(w15, 18)),
+                                          _mm256_srli_epi32(w15, 3));
+            __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(SHA256_X8_ROTR(w2, 17), SHA256_X8_ROTR(w2, 19)),
+                                          _mm256_srli_epi32(w2, 10));
+            w[i & 15] = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], s0),
+                                         _mm256_add_epi32(w[(i - 7) & 15], s1));
+        }
+
+        __m256i ep1 = _mm256_xor_si256(_mm256_xor_si256(SHA256_X8_ROTR(e, 6), SHA256_X8_ROTR(e, 11)),
+                                       SHA256_X8_ROTR(e, 25));
+        __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, ep1),
+                                      _mm256_add_epi32(_mm256_add_epi32(ch, w[i & 15]),
+                                                       _mm256_set1_epi32((int)K[i])));
+        __m256i ep0 = _mm256_xor_si256(_mm256_xor_si256(SHA256_X8_ROTR(a, 2), SHA256_X8_ROTR(a, 13)),
+                                       SHA256_X8_ROTR(a, 22));
+        __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        __m256i t2 = _mm256_add_epi32(ep0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    _mm256_storeu_si256((__m256i *)state[0], _mm256_add_epi32(a, _mm256_loadu_si256((const __m256i *)state[0])));
+    _mm256_storeu_si256((__m256i *)state[1], _mm256_add_epi32(b, _mm256_loadu_si256((const __m256i *)state[1])));
+    _mm256_storeu_si256((__m256i *)state[2], _mm256_add_epi32(c, _mm256_loadu_si256((const __m256i *)state[2])));
+    _mm256_storeu_si256((__m256i *)state[3], _mm256_add_epi32(d, _mm256_loadu_si256((const __m256i *)state[3])));
+    _mm256_storeu_si256((__m256i *)state[4], _mm256_add_epi32(e, _mm256_loadu_si256((const __m256i *)state[4])));
+    _mm256_storeu_si256((__m256i *)state[5], _mm256_add_epi32(f, _mm256_loadu_si256((const __m256i *)state[5])));
+    _mm256_storeu_si256((__m256i *)state[6], _mm256_add_epi32(g, _mm256_loadu_si256((const __m256i *)state[6])));
+    _mm256_storeu_si256((__m256i *)state[7], _mm256_add_epi32(h, _mm256_loadu_si256((const __m256i *)state[7])));
+}
+
+#undef SHA256_X8_ROTR
+
+#endif /* ACP_HAVE_X86_KERNELS */
+
+typedef void (*sha256_compress_x8_fn_t)(uint32_t state[8][SHA256_LANES], const uint8_t *const blocks[SHA256_LANES]);
+
+/**
+ * @brief Start the inner hash of a frame in a lane
+ */
+static void hmac_lane_start(sha256_lane_t *lane, uint32_t state[8][SHA256_LANES], size_t l,
+                            const acp_hmac_verify_item_t *item, size_t index)
+{
+    size_t whole = item->data_len / ACP_SHA256_BLOCK_SIZE;
+
+    for (int w = 0; w < 8; w++)
+    {
+        state[w][l] = item->key->inner[w];
+    }
+
+    lane->data = item->data;
+    lane->data_blocks = whole;
+    lane->item = index;
+    lane->outer = 0;
+    sha256_lane_pad(lane, item->data + whole * ACP_SHA256_BLOCK_SIZE,
+                    item->data_len - whole * ACP_SHA256_BLOCK_SIZE,
+                    ACP_SHA256_BLOCK_SIZE + (uint64_t)item->data_len);
+}
+
+/**
+ * @brief Compute truncated HMAC tags for a batch with a multi-buffer kernel
+ *
+ * Each lane runs one frame's inner and then outer hash; when a lane
+ * finishes it is refilled with the next frame, so lanes stay busy even
+ * when frame lengths differ. Idle lanes hash a dummy block.
+ */
+static void hmac_batch_multibuffer(sha256_compress_x8_fn_t compress,
+                                   const acp_hmac_verify_item_t *items, size_t count,
+                                   uint8_t macs[][ACP_HMAC_SIZE])
+{
+    static const uint8_t idle_block[ACP_SHA256_BLOCK_SIZE];
+    uint32_t state[8][SHA256_LANES];
+    sha256_lane_t lanes[SHA256_LANES];
+    const uint8_t *blocks[SHA256_LANES];
+    int active[SHA256_LANES];
+    size_t next = 0;
+    size_t running = 0;
+
+    memset(state, 0, sizeof(state));
+    for (size_t l = 0; l < SHA256_LANES; l++)
+    {
+        active[l] = (next < count);
+        if (active[l])
+        {
+            hmac_lane_start(&lanes[l], state, l, &items[next], next);
+            next++;
+            running++;
+        }
+    }
+
+    while (running > 0)
+    {
+        for (size_t l = 0; l < SHA256_LANES; l++)
+        {
+            sha256_lane_t *lane = &lanes[l];
+            if (!active[l])
+            {
+                blocks[l] = idle_block;
+            }
+            else if (lane->data_blocks > 0)
+            {
+                blocks[l] = lane->data;
+                lane->data += ACP_SHA256_BLOCK_SIZE;
+                lane->data_blocks--;
+            }
+            else
+            {
+                blocks[l] = lane->pad + lane->pad_pos;
+                lane->pad_pos += ACP_SHA256_BLOCK_SIZE;
+                lane->pad_blocks--;
+            }
+        }
+
+        compress(state, blocks);
+
+        for (size_t l = 0; l < SHA256_LANES; l++)
+        {
+            sha256_lane_t *lane = &lanes[l];
+            if (!active[l] || lane->data_blocks > 0 || lane->pad_blocks > 0)
+            {
+                continue;
+            }
+
+            uint8_t digest[ACP_SHA256_SIZE];
+            for (int w = 0; w < 8; w++)
+            {
+                digest[w * 4] = (uint8_t)(state[w][l] >> 24);
+                digest[w * 4 + 1] = (uint8_t)(state[w][l] >> 16);
+                digest[w * 4 + 2] = (uint8_t)(state[w][l] >> 8);
+                digest[w * 4 + 3] = (uint8_t)(state[w][l]);
+            }
+
+            if (!lane->outer)
+            {
+                /* Outer hash: SHA256(K XOR opad || inner_hash) */
+                for (int w = 0; w < 8; w++)
+                {
+                    state[w][l] = items[lane->item].key->outer[w];
+                }
+                lane->outer = 1;
+                sha256_lane_pad(lane, digest, ACP_SHA256_SIZE, ACP_SHA256_BLOCK_SIZE + ACP_SHA256_SIZE);
+            }
+            else
+            {
+                memcpy(macs[lane->item], digest, ACP_HMAC_SIZE);
+                if (next < count)
+                {
+                    hmac_lane_start(lane, state, l, &items[next], next);
+                    next++;
+                }
+                else
+                {
+                    active[l] = 0;
+                    running--;
+                }
+            }
+            acp_crypto_clear(digest, sizeof(digest));
+        }
+    }
+
+    /* Clear sensitive data */
+    acp_crypto_clear(state, sizeof(state));
+    acp_crypto_clear(lanes, sizeof(lanes));
+}
+
+int acp_hmac_verify_batch(const acp_hmac_verify_item_t *items, size_t count,
+                          uint64_t *valid_mask)
+{
+    acp_hmac_verify_item_t usable[ACP_HMAC_BATCH_MAX];
+    size_t usable_index[ACP_HMAC_BATCH_MAX];
+    uint8_t macs[ACP_HMAC_BATCH_MAX][ACP_HMAC_SIZE];
+    size_t n = 0;
+
+    if (!valid_mask || (!items && count > 0) || count > ACP_HMAC_BATCH_MAX)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    *valid_mask = 0;
+
+    /* Malformed items are reported as failed without being hashed */
+    for (size_t i = 0; i < count; i++)
+    {
+        if (items[i].key && items[i].data && items[i].tag)
+        {
+            usable[n] = items[i];
+            usable_index[n] = i;
+            n++;
+        }
+    }
+
+    sha256_compress_x8_fn_t compress = NULL;
+#ifdef ACP_HAVE_X86_KERNELS
+    if (n > 1 && (acp_cpu_features() & ACP_CPU_AVX2))
+    {
+        /* Eight AVX2 lanes beat one SHA-NI stream only on short frames */
+        size_t total_len = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            total_len += usable[i].data_len;
+        }
+        if (acp_sha256_get_kernel() == ACP_SHA256_KERNEL_SCALAR ||
+            total_len < n * HMAC_BATCH_SERIAL_MIN_LEN)
+        {
+            compress = sha256_compress_avx2_x8;
+        }
+    }
+#endif
+
+    if (compress)
+    {
+        hmac_batch_multibuffer(compress, usable, n, macs);
+    }
+    else
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            acp_hmac_sha256_midstate(usable[i].key, usable[i].data, usable[i].data_len, macs[i]);
+        }
+    }
+
+    /* Constant-time tag comparison */
+    for (size_t i = 0; i < n; i++)
+    {
+        uint64_t ok = (uint64_t)(acp_crypto_memcmp_ct(macs[i], usable[i].tag, ACP_HMAC_SIZE) == 0);
+        *valid_mask |= ok << usable_index[i];
+    }
+
+    acp_crypto_clear(macs, sizeof(macs));
+    return ACP_OK;
+}
+
 /* ========================================================================== */
 /*                              Utility Functions                             */
 /* ========================================================================== */
@@ -360,19 +1001,31 @@ int acp_sha256_self_test(void)
 
 int acp_hmac_self_test(void)
 {
-    /* Simple consistency test - verify our implementation produces consistent results */
-    const uint8_t key[] = "test_key_123456789012345678901234"; /* 32 bytes */
-    const uint8_t data[] = "test_data";
+    /* RFC 4231 test case 2 */
+    const uint8_t key[] = "Jefe";
+    const uint8_t data[] = "what do ya want for nothing?";
+    const uint8_t expected[] = {
+        0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e,
+        0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+        0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83,
+        0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43};
+
+    uint8_t result[ACP_HMAC_FULL_SIZE];
+    uint8_t truncated[ACP_HMAC_SIZE];
+    acp_hmac_midstate_t midstate;
+    int failures = 0;
 
-    uint8_t result1[ACP_SHA256_SIZE];
-    uint8_t result2[ACP_SHA256_SIZE];
+    /* One-shot */
+    acp_hmac_sha256(key, sizeof(key) - 1, data, sizeof(data) - 1, result);
+    failures += acp_crypto_memcmp_ct(result, expected, ACP_HMAC_FULL_SIZE) != 0;
 
-    /* Run HMAC twice with same inputs */
-    acp_hmac_sha256(key, sizeof(key) - 1, data, sizeof(data) - 1, result1);
-    acp_hmac_sha256(key, sizeof(key) - 1, data, sizeof(data) - 1, result2);
+    /* Precomputed midstates */
+    acp_hmac_midstate_init(&midstate, key, sizeof(key) - 1);
+    acp_hmac_sha256_midstate(&midstate, data, sizeof(data) - 1, truncated);
+    failures += acp_crypto_memcmp_ct(truncated, expected, ACP_HMAC_SIZE) != 0;
 
-    /* Should produce identical results */
-    return acp_crypto_memcmp_ct(result1, result2, ACP_SHA256_SIZE);
+    acp_crypto_clear(&midstate, sizeof(midstate));
+    return failures;
 }
 
 int acp_crypto_self_test(void)
@@ -87,11 +87,23 @@ extern "C"
      */
     typedef struct
     {
-        acp_sha256_ctx_t inner; /**< Inner hash context */
-        acp_sha256_ctx_t outer; /**< Outer hash context */
-        uint8_t key_pad[64];    /**< Padded key storage */
+        acp_sha256_ctx_t inner; /**< Inner hash context (key XOR ipad absorbed) */
+        acp_sha256_ctx_t outer; /**< Outer hash context (key XOR opad absorbed) */
     } acp_hmac_ctx_t;
 
+    /**
+     * @brief Precomputed HMAC-SHA256 key midstates
+     *
+     * SHA-256 states after absorbing the key XOR ipad and key XOR opad
+     * blocks. They depend only on the key, so computing them once per key
+     * saves two compression-function calls on every MAC.
+     */
+    typedef struct
+    {
+        uint32_t inner[8]; /**< State after the inner padded key block */
+        uint32_t outer[8]; /**< State after the outer padded key block */
+    } acp_hmac_midstate_t;
+
     /* ========================================================================== */
     /*                            SHA-256 Functions                              */
     /* ========================================================================== */
@@ -125,6 +137,42 @@ extern "C"
      */
     void acp_sha256(const uint8_t *data, size_t len, uint8_t *hash);
 
+    /**
+     * @brief SHA-256 compression kernels
+     */
+    typedef enum
+    {
+        ACP_SHA256_KERNEL_AUTO = 0, /**< Best kernel for the running CPU */
+        ACP_SHA256_KERNEL_SCALAR,   /**< Portable C */
+        ACP_SHA256_KERNEL_SHANI,    /**< x86 SHA extensions */
+        ACP_SHA256_KERNEL_COUNT
+    } acp_sha256_kernel_t;
+
+    /**
+     * @brief Select the SHA-256 compression kernel
+     *
+     * The kernel is otherwise chosen on first use from the CPU features.
+     * It applies to SHA-256 and HMAC-SHA256 alike.
+     *
+     * @param kernel Kernel to use (ACP_SHA256_KERNEL_AUTO for runtime detection)
+     * @return 0 on success, ACP_ERR_NOT_IMPLEMENTED if the kernel is not
+     *         available on this build or CPU
+     */
+    int acp_sha256_set_kernel(acp_sha256_kernel_t kernel);
+
+    /**
+     * @brief Get the active SHA-256 compression kernel
+     * @return Active kernel (never ACP_SHA256_KERNEL_AUTO)
+     */
+    acp_sha256_kernel_t acp_sha256_get_kernel(void);
+
+    /**
+     * @brief Get a printable kernel name
+     * @param kernel Kernel identifier
+     * @return Static name string
+     */
+    const char *acp_sha256_kernel_name(acp_sha256_kernel_t kernel);
+
     /* ========================================================================== */
     /*                           HMAC-SHA256 Functions                           */
     /* ========================================================================== */
@@ -153,6 +201,36 @@ extern "C"
      */
     void acp_hmac_final(acp_hmac_ctx_t *ctx, uint8_t *mac, int truncated);
 
+    /**
+     * @brief Precompute HMAC-SHA256 midstates for a key
+     * @param midstate Midstates to fill
+     * @param key HMAC key
+     * @param key_len Length of key in bytes
+     */
+    void acp_hmac_midstate_init(acp_hmac_midstate_t *midstate, const uint8_t *key, size_t key_len);
+
+    /**
+     * @brief Initialize HMAC-SHA256 context from precomputed midstates
+     *
+     * Equivalent to acp_hmac_init() with the key the midstates were
+     * computed from, without hashing the padded key blocks again.
+     *
+     * @param ctx HMAC context to initialize
+     * @param midstate Midstates from acp_hmac_midstate_init()
+     */
+    void acp_hmac_init_midstate(acp_hmac_ctx_t *ctx, const acp_hmac_midstate_t *midstate);
+
+    /**
+     * @brief Compute HMAC-SHA256 in one operation from precomputed midstates
+     * @param midstate Midstates from acp_hmac_midstate_init()
+     * @param data Input data to authenticate
+     * @param data_len Length of input data
+     * @param mac Output MAC (16 bytes truncated)
+     */
+    void acp_hmac_sha256_midstate(const acp_hmac_midstate_t *midstate,
+                                  const uint8_t *data, size_t data_len,
+                                  uint8_t *mac);
+
     /**
      * @brief Compute HMAC-SHA256 in one operation
      * @param key HMAC key
@@ -165,6 +243,42 @@ extern "C"
                          const uint8_t *data, size_t data_len,
                          uint8_t *mac);
 
+    /* ========================================================================== */
+    /*                          Batch HMAC Verification                          */
+    /* ========================================================================== */
+
+/** @brief Maximum number of frames per acp_hmac_verify_batch() call */
+#define ACP_HMAC_BATCH_MAX 64
+
+    /**
+     * @brief One frame to authenticate in a batch
+     */
+    typedef struct
+    {
+        const acp_hmac_midstate_t *key; /**< Key midstates (e.g. the session's) */
+        const uint8_t *data;            /**< Authenticated bytes */
+        size_t data_len;                /**< Length of authenticated bytes */
+        const uint8_t *tag;             /**< Received ACP_HMAC_SIZE-byte tag */
+    } acp_hmac_verify_item_t;
+
+    /**
+     * @brief Verify the truncated HMAC-SHA256 tags of several frames at once
+     *
+     * Frames may use different keys and lengths. On CPUs with AVX2, eight
+     * frames are hashed in parallel SIMD lanes, unless the SHA extensions
+     * are in use and the frames are long enough for a serial loop over
+     * them to be faster. Otherwise frames are verified one after another. Tags are
+     * compared in constant time on both paths. Items with a NULL key, data
+     * or tag pointer are reported as failed.
+     *
+     * @param items Frames to verify
+     * @param count Number of frames (at most ACP_HMAC_BATCH_MAX)
+     * @param valid_mask Returns bit i set if frame i carries a valid tag
+     * @return 0 on success, ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    int acp_hmac_verify_batch(const acp_hmac_verify_item_t *items, size_t count,
+                              uint64_t *valid_mask);
+
     /* ========================================================================== */
     /*                            Utility Functions                              */
     /* ========================================================================== */
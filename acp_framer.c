@@ -35,6 +35,7 @@
 #include "acp_errors.h"
 #include "acp_crc16.h"
 #include "acp_cobs.h"
+#include "acp_scan.h"
 #include "acp_platform_log.h"
 
 #include <string.h>
@@ -43,18 +44,46 @@
 /*                           Frame Processing                                 */
 /* ========================================================================== */
 
-int acp_frame_encode(const acp_frame_t *frame, uint8_t *output, size_t output_size, size_t *bytes_written)
+int acp_frame_encode_view(const acp_frame_view_t *view, uint8_t *output, size_t output_size, size_t *bytes_written)
 {
-    if (!frame || !output || !bytes_written)
+    if (!view || (!view->payload && view->length > 0))
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    acp_iovec_t segment = {view->payload, view->length};
+    return acp_frame_encode_iov(view, &segment, 1, output, output_size, bytes_written);
+}
+
+int acp_frame_encode_iov(const acp_frame_view_t *view,
+                         const acp_iovec_t *payload, size_t payload_count,
+                         uint8_t *output, size_t output_size, size_t *bytes_written)
+{
+    if (!view || !output || !bytes_written || (!payload && payload_count > 0))
     {
         return ACP_ERR_INVALID_PARAM;
     }
 
     *bytes_written = 0;
 
+    size_t payload_len = 0;
+    for (size_t i = 0; i < payload_count; i++)
+    {
+        if (!payload[i].base && payload[i].len > 0)
+        {
+            return ACP_ERR_INVALID_PARAM;
+        }
+        payload_len += payload[i].len;
+        if (payload_len > ACP_MAX_PAYLOAD_SIZE)
+        {
+            ACP_LOG_ERROR("Payload too large: %zu bytes", payload_len);
+            return ACP_ERR_PAYLOAD_TOO_LARGE;
+        }
+    }
+
     /* Calculate variable header size based on flags */
-    size_t header_size = acp_wire_header_size(frame->flags);
-    size_t wire_frame_size = header_size + frame->length + 2; /* +2 for CRC */
+    size_t header_size = acp_wire_header_size(view->flags);
+    size_t wire_frame_size = header_size + payload_len + 2; /* +2 for CRC */
 
     /* Check if we have space for worst-case COBS encoding */
     size_t max_encoded_size = acp_cobs_max_encoded_size(wire_frame_size) + 2; /* +2 for delimiters */
@@ -64,52 +93,45 @@ int acp_frame_encode(const acp_frame_t *frame, uint8_t *output, size_t output_si
         return ACP_ERR_BUFFER_TOO_SMALL;
     }
 
-    /* Build wire frame in temporary buffer */
-    uint8_t wire_frame[ACP_MAX_FRAME_SIZE];
-    if (wire_frame_size > sizeof(wire_frame))
+    /* Build wire header: base fields, length in network byte order */
+    uint8_t header[sizeof(acp_wire_header_t)];
+    header[0] = view->version;
+    header[1] = view->type;
+    header[2] = view->flags;
+    header[3] = 0; /* reserved */
+    header[4] = (uint8_t)((payload_len >> 8) & 0xFF);
+    header[5] = (uint8_t)(payload_len & 0xFF);
+
+    /* Add conditional sequence field (network byte order) if authenticated */
+    if (view->flags & ACP_FLAG_AUTHENTICATED)
     {
-        ACP_LOG_ERROR("Frame too large: %zu bytes", wire_frame_size);
-        return ACP_ERR_PAYLOAD_TOO_LARGE;
+        header[6] = (uint8_t)((view->sequence >> 24) & 0xFF);
+        header[7] = (uint8_t)((view->sequence >> 16) & 0xFF);
+        header[8] = (uint8_t)((view->sequence >> 8) & 0xFF);
+        header[9] = (uint8_t)(view->sequence & 0xFF);
     }
 
-    /* Create base wire header */
-    acp_wire_header_base_t *base_header = (acp_wire_header_base_t *)wire_frame;
-    base_header->version = frame->version;
-    base_header->type = frame->type;
-    base_header->flags = frame->flags;
-    base_header->reserved = 0;
-    base_header->length = frame->length; /* Host byte order for now */
-
-    /* Convert length to network byte order */
-    base_header->length = ((base_header->length & 0xFF) << 8) | ((base_header->length >> 8) & 0xFF);
-
-    /* Add conditional sequence field if authenticated */
-    uint8_t *payload_start = wire_frame + sizeof(acp_wire_header_base_t);
-    if (frame->flags & ACP_FLAG_AUTHENTICATED)
+    /*
+     * Stream header, payload and CRC through the COBS stuffer straight into
+     * the output, computing the CRC inline; no wire-frame staging copy.
+     */
+    acp_cobs_encoder_t encoder;
+    uint16_t crc = acp_crc16_init();
+    acp_cobs_encoder_init(&encoder, output + 1, output_size - 2);
+    acp_cobs_encoder_write_crc16(&encoder, header, header_size, &crc);
+    for (size_t i = 0; i < payload_count; i++)
     {
-        /* Add sequence number in network byte order */
-        uint32_t seq_be = ((frame->sequence & 0xFF) << 24) |
-                          (((frame->sequence >> 8) & 0xFF) << 16) |
-                          (((frame->sequence >> 16) & 0xFF) << 8) |
-                          ((frame->sequence >> 24) & 0xFF);
-        memcpy(payload_start, &seq_be, sizeof(uint32_t));
-        payload_start += sizeof(uint32_t);
+        acp_cobs_encoder_write_crc16(&encoder, (const uint8_t *)payload[i].base, payload[i].len, &crc);
     }
+    crc = acp_crc16_finalize(crc);
 
-    /* Copy payload */
-    if (frame->length > 0)
-    {
-        memcpy(payload_start, frame->payload, frame->length);
-    }
+    uint8_t crc_bytes[2];
+    crc_bytes[0] = (uint8_t)(crc & 0xFF);
+    crc_bytes[1] = (uint8_t)((crc >> 8) & 0xFF);
+    acp_cobs_encoder_write(&encoder, crc_bytes, sizeof(crc_bytes));
 
-    /* Calculate and append CRC16 */
-    uint16_t crc = acp_crc16_calculate(wire_frame, wire_frame_size - 2);
-    wire_frame[wire_frame_size - 2] = (uint8_t)(crc & 0xFF);
-    wire_frame[wire_frame_size - 1] = (uint8_t)((crc >> 8) & 0xFF);
-
-    /* COBS encode the frame */
     size_t encoded_len;
-    int result = acp_cobs_encode(wire_frame, wire_frame_size, output + 1, output_size - 2, &encoded_len);
+    int result = acp_cobs_encoder_finish(&encoder, &encoded_len);
     if (result != ACP_OK)
     {
         ACP_LOG_ERROR("COBS encoding failed: %d", result);
@@ -123,57 +145,37 @@ int acp_frame_encode(const acp_frame_t *frame, uint8_t *output, size_t output_si
     *bytes_written = encoded_len + 2;
 
     ACP_LOG_DEBUG("Encoded frame: type=0x%02X, payload=%zu bytes, total=%zu bytes",
-                  frame->type, (size_t)frame->length, *bytes_written);
+                  view->type, payload_len, *bytes_written);
 
     return ACP_OK;
 }
 
-int acp_frame_decode(const uint8_t *input, size_t input_size, acp_frame_t *frame, size_t *bytes_consumed)
+int acp_frame_encode(const acp_frame_t *frame, uint8_t *output, size_t output_size, size_t *bytes_written)
 {
-    if (!input || !frame || !bytes_consumed)
+    if (!frame || !output || !bytes_written)
     {
         return ACP_ERR_INVALID_PARAM;
     }
 
-    *bytes_consumed = 0;
-
-    /* Need at least minimum frame size (base header + CRC + delimiters) */
-    if (input_size < sizeof(acp_wire_header_base_t) + 2 + 2)
-    { /* base header + CRC + delimiters */
-        return ACP_ERR_NEED_MORE_DATA;
-    }
-
-    /* Find frame boundaries */
-    if (input[0] != ACP_COBS_DELIMITER)
-    {
-        ACP_LOG_WARN("Missing frame start delimiter");
-        return ACP_ERR_MALFORMED_FRAME;
-    }
-
-    /* Find end delimiter */
-    size_t frame_end = 0;
-    for (size_t i = 1; i < input_size; i++)
-    {
-        if (input[i] == ACP_COBS_DELIMITER)
-        {
-            frame_end = i;
-            break;
-        }
-    }
-
-    if (frame_end == 0)
-    {
-        return ACP_ERR_NEED_MORE_DATA;
-    }
+    acp_frame_view_t view;
+    view.version = frame->version;
+    view.type = frame->type;
+    view.flags = frame->flags;
+    view.length = frame->length;
+    view.sequence = frame->sequence;
+    view.payload = frame->payload;
+    view.crc16 = 0;
+    view.hmac_tag = NULL;
+
+    return acp_frame_encode_view(&view, output, output_size, bytes_written);
+}
 
-    /* COBS decode the frame content */
-    uint8_t decoded_frame[ACP_MAX_FRAME_SIZE];
-    size_t decoded_len;
-    int result = acp_cobs_decode(input + 1, frame_end - 1, decoded_frame, sizeof(decoded_frame), &decoded_len);
-    if (result != ACP_OK)
+int acp_frame_parse_decoded(const uint8_t *decoded, size_t decoded_len,
+                            uint16_t calculated_crc, acp_frame_view_t *view)
+{
+    if (!decoded || !view)
     {
-        ACP_LOG_ERROR("COBS decoding failed: %d", result);
-        return result;
+        return ACP_ERR_INVALID_PARAM;
     }
 
     /* Need at least base header + CRC */
@@ -184,7 +186,7 @@ int acp_frame_decode(const uint8_t *input, size_t input_size, acp_frame_t *frame
     }
 
     /* Parse base wire header */
-    const acp_wire_header_base_t *base_header = (const acp_wire_header_base_t *)decoded_frame;
+    const acp_wire_header_base_t *base_header = (const acp_wire_header_base_t *)decoded;
 
     /* Calculate expected header size based on flags */
     size_t expected_header_size = acp_wire_header_size(base_header->flags);
@@ -198,8 +200,7 @@ int acp_frame_decode(const uint8_t *input, size_t input_size, acp_frame_t *frame
     }
 
     /* Verify CRC */
-    uint16_t calculated_crc = acp_crc16_calculate(decoded_frame, decoded_len - 2);
-    uint16_t received_crc = ((uint16_t)decoded_frame[decoded_len - 1] << 8) | decoded_frame[decoded_len - 2];
+    uint16_t received_crc = ((uint16_t)decoded[decoded_len - 1] << 8) | decoded[decoded_len - 2];
 
     if (calculated_crc != received_crc)
     {
@@ -218,15 +219,23 @@ int acp_frame_decode(const uint8_t *input, size_t input_size, acp_frame_t *frame
         return ACP_ERR_MALFORMED_FRAME;
     }
 
-    /* Fill in frame structure */
-    frame->version = base_header->version;
-    frame->type = base_header->type;
-    frame->flags = base_header->flags;
-    frame->length = payload_len;
+    if (payload_len > ACP_MAX_PAYLOAD_SIZE)
+    {
+        ACP_LOG_ERROR("Payload too large: %u bytes", payload_len);
+        return ACP_ERR_PAYLOAD_TOO_LARGE;
+    }
+
+    /* Fill in frame view */
+    view->version = base_header->version;
+    view->type = base_header->type;
+    view->flags = base_header->flags;
+    view->length = payload_len;
+    view->crc16 = received_crc;
+    view->hmac_tag = NULL;
 
     /* Parse conditional sequence field */
     uint32_t sequence = 0;
-    const uint8_t *payload_start = decoded_frame + sizeof(acp_wire_header_base_t);
+    const uint8_t *payload_start = decoded + sizeof(acp_wire_header_base_t);
     if (base_header->flags & ACP_FLAG_AUTHENTICATED)
     {
         /* Extract sequence number from network byte order */
@@ -238,23 +247,160 @@ int acp_frame_decode(const uint8_t *input, size_t input_size, acp_frame_t *frame
                    ((seq_be >> 24) & 0xFF);
         payload_start += sizeof(uint32_t);
     }
-    frame->sequence = sequence;
+    view->sequence = sequence;
+    view->payload = payload_start;
 
-    /* Copy payload if present */
-    if (payload_len > 0)
+    return ACP_OK;
+}
+
+int acp_frame_decode_view(const uint8_t *input, size_t input_size,
+                          uint8_t *decode_buf, size_t decode_buf_size,
+                          acp_frame_view_t *view, size_t *bytes_consumed)
+{
+    if (!input)
     {
-        if (payload_len > ACP_MAX_PAYLOAD_SIZE)
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    return acp_frame_decode_view_split(input, input_size, NULL, 0, decode_buf, decode_buf_size,
+                                       view, bytes_consumed);
+}
+
+/**
+ * @brief Offset of the first delimiter at or after @p from in head|tail
+ *
+ * Returns the total length when there is none, so skipping to the result
+ * always discards only bytes that cannot start a frame.
+ */
+static size_t framer_next_delimiter(const uint8_t *head, size_t head_size,
+                                    const uint8_t *tail, size_t tail_size, size_t from)
+{
+    if (from < head_size)
+    {
+        size_t clean = acp_scan_zero(head + from, head_size - from);
+        if (from + clean < head_size)
         {
-            ACP_LOG_ERROR("Payload too large: %u bytes", payload_len);
-            return ACP_ERR_PAYLOAD_TOO_LARGE;
+            return from + clean;
         }
-        memcpy(frame->payload, payload_start, payload_len);
+        from = head_size;
+    }
+    return from + acp_scan_zero(tail + (from - head_size), tail_size - (from - head_size));
+}
+
+int acp_frame_decode_view_split(const uint8_t *head, size_t head_size,
+                                const uint8_t *tail, size_t tail_size,
+                                uint8_t *decode_buf, size_t decode_buf_size,
+                                acp_frame_view_t *view, size_t *bytes_consumed)
+{
+    if ((!head && head_size > 0) || (!tail && tail_size > 0) || !decode_buf || !view || !bytes_consumed)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    *bytes_consumed = 0;
+
+    /* An empty head means the frame starts at the seam */
+    if (head_size == 0)
+    {
+        head = tail;
+        head_size = tail_size;
+        tail = NULL;
+        tail_size = 0;
+    }
+    if (head_size == 0)
+    {
+        return ACP_ERR_NEED_MORE_DATA;
+    }
+
+    /*
+     * Errors below report the bytes up to the next delimiter as consumed,
+     * leaving the delimiter itself as the next candidate opening. Callers
+     * that skip @p bytes_consumed on error thus pass over noise and damaged
+     * frames in one step instead of retrying at every byte.
+     */
+    if (head[0] != ACP_COBS_DELIMITER)
+    {
+        ACP_LOG_WARN("Missing frame start delimiter");
+        *bytes_consumed = framer_next_delimiter(head, head_size, tail, tail_size, 0);
+        return ACP_ERR_MALFORMED_FRAME;
+    }
+
+    /* Need at least minimum frame size (base header + CRC + delimiters) */
+    if (head_size + tail_size < sizeof(acp_wire_header_base_t) + 2 + 2)
+    { /* base header + CRC + delimiters */
+        return ACP_ERR_NEED_MORE_DATA;
+    }
+
+    /*
+     * Scan for the end delimiter, COBS decode into the caller's buffer and
+     * compute the CRC in a single pass over the encoded bytes, continuing
+     * into the tail when the frame crosses the seam.
+     */
+    size_t decoded_len;
+    size_t frame_consumed;
+    uint16_t calculated_crc;
+    int result = acp_cobs_decode_crc16_split(head + 1, head_size - 1, tail, tail_size,
+                                             decode_buf, decode_buf_size,
+                                             &decoded_len, &frame_consumed, &calculated_crc);
+    if (result == ACP_ERR_NEED_MORE_DATA)
+    {
+        return result;
+    }
+    if (result != ACP_OK)
+    {
+        ACP_LOG_ERROR("COBS decoding failed: %d", result);
+        /* A truncated block reports just past the delimiter that cut it short */
+        *bytes_consumed = (frame_consumed > 0)
+                              ? frame_consumed
+                              : framer_next_delimiter(head, head_size, tail, tail_size, 1);
+        return result;
     }
 
-    *bytes_consumed = frame_end + 1;
+    result = acp_frame_parse_decoded(decode_buf, decoded_len, calculated_crc, view);
+    if (result != ACP_OK)
+    {
+        /* Up to the closing delimiter */
+        *bytes_consumed = frame_consumed;
+        return result;
+    }
+
+    *bytes_consumed = frame_consumed + 1; /* + opening delimiter */
 
     ACP_LOG_DEBUG("Decoded frame: type=0x%02X, payload=%u bytes, consumed=%zu bytes",
-                  frame->type, payload_len, *bytes_consumed);
+                  view->type, view->length, *bytes_consumed);
+
+    return ACP_OK;
+}
+
+int acp_frame_decode(const uint8_t *input, size_t input_size, acp_frame_t *frame, size_t *bytes_consumed)
+{
+    if (!input || !frame || !bytes_consumed)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    uint8_t decoded_frame[ACP_DECODE_BUFFER_SIZE];
+    acp_frame_view_t view;
+    int result = acp_frame_decode_view(input, input_size, decoded_frame, sizeof(decoded_frame),
+                                       &view, bytes_consumed);
+    if (result != ACP_OK)
+    {
+        return result;
+    }
+
+    /* Fill in frame structure */
+    frame->version = view.version;
+    frame->type = view.type;
+    frame->flags = view.flags;
+    frame->length = view.length;
+    frame->sequence = view.sequence;
+    frame->crc16 = view.crc16;
+
+    /* Copy payload if present */
+    if (view.length > 0)
+    {
+        memcpy(frame->payload, view.payload, view.length);
+    }
 
     return ACP_OK;
 }
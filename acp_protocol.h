@@ -39,6 +39,10 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+#include "acp_config.h"
+#include "acp_crypto.h"
+#include "acp_cobs.h"
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -183,20 +187,108 @@ extern "C"
         uint8_t hmac_tag[ACP_HMAC_TAG_LEN];    /**< HMAC tag (if authenticated) */
     } acp_frame_t;
 
+    /**
+     * @brief ACP frame view (zero-copy host representation)
+     *
+     * Carries the decoded header fields of a frame together with a pointer
+     * into the caller-owned decode buffer, so the payload is never copied
+     * out of the buffer it was COBS-decoded into. The view is only valid
+     * while that buffer (and, for the tag, the input stream) is unchanged.
+     */
+    typedef struct
+    {
+        uint8_t version;         /**< Protocol version */
+        uint8_t type;            /**< Frame type */
+        uint8_t flags;           /**< Frame flags */
+        uint16_t length;         /**< Payload length */
+        uint32_t sequence;       /**< Sequence number (if authenticated) */
+        const uint8_t *payload;  /**< Payload inside the decode buffer */
+        uint16_t crc16;          /**< CRC16-CCITT checksum */
+        const uint8_t *hmac_tag; /**< HMAC tag inside the input (NULL if unauthenticated) */
+    } acp_frame_view_t;
+
+    /**
+     * @brief Payload segment for scatter-gather encoding
+     *
+     * Mirrors POSIX struct iovec, which cannot be used on every target.
+     */
+    typedef struct
+    {
+        const void *base; /**< Segment start */
+        size_t len;       /**< Segment length in bytes */
+    } acp_iovec_t;
+
+    /**
+     * @brief One frame to encode with acp_encode_batch()
+     */
+    typedef struct
+    {
+        uint8_t type;               /**< Frame type (acp_frame_type_t) */
+        uint8_t flags;              /**< Frame flags (ACP_FLAG_*) */
+        const acp_iovec_t *payload; /**< Payload segments, concatenated in order */
+        size_t payload_count;       /**< Number of payload segments */
+    } acp_encode_desc_t;
+
+/** @brief Decode buffer size sufficient for any single frame view */
+#define ACP_DECODE_BUFFER_SIZE ACP_MAX_FRAME_SIZE
+
+/** @brief Smallest replay window accepted by acp_session_set_replay_window() */
+#define ACP_REPLAY_WINDOW_MIN 64
+
+/** @brief Largest replay window accepted by acp_session_set_replay_window() */
+#define ACP_REPLAY_WINDOW_MAX 1024
+
+/** @brief Bitmap words for the largest window, plus one so shifts clear whole words */
+#define ACP_REPLAY_WINDOW_WORDS (ACP_REPLAY_WINDOW_MAX / 64 + 1)
+
     /**
      * @brief ACP session structure for authentication state
+     *
+     * Laid out in three sections on separate cache lines: the transmit
+     * counter, written by senders; the receive state, written by the
+     * receiver; and the key material and settings, read by both but
+     * written only by init, rotate and the setters. A sender and a
+     * receiver on different cores therefore never write the same line.
+     * Use the acp_session_*() accessors rather than the fields.
      */
     typedef struct
     {
-        uint32_t key_id;            /**< Key identifier for keystore lookup */
-        uint8_t key[32];            /**< HMAC key material (256 bits) */
-        uint64_t nonce;             /**< Session nonce */
-        uint32_t next_sequence;     /**< Next sequence number to send */
-        uint32_t last_accepted_seq; /**< Last accepted sequence number */
-        uint8_t policy_flags;       /**< Session policy (reserved) */
-        bool initialized;           /**< Session initialization flag */
+        /* Transmit cache line */
+        ACP_CACHE_ALIGNED uint64_t next_sequence; /**< Next sequence number to send */
+        uint8_t tx_pad[ACP_CACHE_LINE_SIZE - sizeof(uint64_t)];
+
+        /* Receive state */
+        ACP_CACHE_ALIGNED uint64_t last_accepted_seq;    /**< Highest accepted sequence number */
+        uint64_t replay_bitmap[ACP_REPLAY_WINDOW_WORDS]; /**< Sequences seen, one bit each, as a ring of words */
+
+        /* Read-mostly: key material and settings */
+        ACP_CACHE_ALIGNED acp_hmac_midstate_t hmac; /**< HMAC midstates precomputed from key */
+        uint8_t key[32];                            /**< HMAC key material (256 bits) */
+        uint64_t nonce;                             /**< Session nonce */
+        uint32_t key_id;                            /**< Key identifier for keystore lookup */
+        uint16_t replay_window;                     /**< Replay window in bits (0: strictly increasing) */
+        uint8_t policy_flags;                       /**< Session policy (reserved) */
+        bool extended_seq;                          /**< 64-bit sequence numbers, low 32 bits on the wire */
+        bool concurrent_tx;                         /**< Sequence numbers allocated atomically */
+        bool initialized;                           /**< Session initialization flag */
     } acp_session_t;
 
+    /**
+     * @brief Block of sequence numbers reserved by one sending thread
+     *
+     * Refilled from the session with a single atomic operation every
+     * @c size frames, so threads sharing a session rarely touch the shared
+     * counter. Frames from different threads then interleave out of order;
+     * the receiver needs a replay window covering threads x block size.
+     */
+    typedef struct
+    {
+        acp_session_t *session; /**< Session the numbers are drawn from */
+        uint64_t next;          /**< Next number to hand out */
+        uint64_t end;           /**< One past the last reserved number */
+        uint32_t size;          /**< Numbers reserved per refill */
+    } acp_seq_block_t;
+
     /* ========================================================================== */
     /*                             Result Codes                                   */
     /* ========================================================================== */
@@ -212,6 +304,8 @@ extern "C"
         ACP_ERR_INVALID_PARAM = -1,    /**< Invalid parameter */
         ACP_ERR_BUFFER_TOO_SMALL = -2, /**< Output buffer too small */
         ACP_ERR_NEED_MORE_DATA = -3,   /**< Need more input data */
+        ACP_ERR_NOT_FOUND = -7,        /**< Requested item not found */
+        ACP_ERR_ALREADY_EXISTS = -8,   /**< Item already exists */
 
         /* Frame format errors */
         ACP_ERR_INVALID_VERSION = -10,   /**< Unsupported protocol version */
@@ -235,6 +329,9 @@ extern "C"
         ACP_ERR_SESSION_EXPIRED = -45,  /**< Session has expired */
         ACP_ERR_REPLAY_ATTACK = -42,    /**< Replay attack detected (alias) */
 
+        /* Platform errors */
+        ACP_ERR_PLATFORM_MUTEX = -52, /**< Platform mutex error */
+
         /* System errors */
         ACP_ERR_IO = -80,              /**< Input/output error */
         ACP_ERR_INVALID_FORMAT = -81,  /**< Invalid file/data format */
@@ -242,6 +339,17 @@ extern "C"
         ACP_ERR_INTERNAL = -99         /**< Internal error */
     } acp_result_t;
 
+    /**
+     * @brief Outcome of one frame found by acp_decode_batch()
+     */
+    typedef struct
+    {
+        acp_frame_view_t view; /**< Decoded frame (zeroed unless result is ACP_OK) */
+        acp_result_t result;   /**< ACP_OK or the error that rejected the frame */
+        size_t offset;         /**< Offset of the frame's opening delimiter in the input */
+        size_t length;         /**< Input bytes taken by the frame */
+    } acp_decode_result_t;
+
     /* ========================================================================== */
     /*                           Core API Functions                              */
     /* ========================================================================== */
@@ -287,6 +395,128 @@ extern "C"
         uint8_t *output,
         size_t *output_len);
 
+    /**
+     * @brief Encode an ACP frame from scattered payload segments
+     *
+     * Scatter-gather counterpart of acp_encode_frame(): the payload is the
+     * concatenation of @p payload_count segments (e.g. a header struct and
+     * a sample array), streamed through CRC16, COBS and HMAC straight from
+     * the caller's memory without first being copied into a staging buffer.
+     * The output is identical to encoding the concatenated payload.
+     *
+     * @param[in]  type           Frame type (acp_frame_type_t)
+     * @param[in]  flags          Frame flags (ACP_FLAG_*)
+     * @param[in]  payload        Payload segments (total 0-ACP_MAX_PAYLOAD_SIZE bytes)
+     * @param[in]  payload_count  Number of segments
+     * @param[in]  session        Session for authentication (NULL for unauthenticated)
+     * @param[out] output         Output buffer for encoded frame
+     * @param[in,out] output_len  Input: buffer size, Output: encoded frame length
+     *
+     * @return ACP_OK on success, error code on failure
+     */
+    acp_result_t acp_encode_frame_iov(
+        uint8_t type,
+        uint8_t flags,
+        const acp_iovec_t *payload,
+        size_t payload_count,
+        acp_session_t *session,
+        uint8_t *output,
+        size_t *output_len);
+
+    /**
+     * @brief Encode an authenticated frame with a caller-supplied sequence number
+     *
+     * Like acp_encode_frame_iov() with ACP_FLAG_AUTHENTICATED, but uses
+     * @p sequence (e.g. from acp_seq_block_take()) and only reads the
+     * session, so any number of threads can encode on one session at once.
+     *
+     * @param[in]  type           Frame type (acp_frame_type_t)
+     * @param[in]  payload        Payload segments (total 0-ACP_MAX_PAYLOAD_SIZE bytes)
+     * @param[in]  payload_count  Number of segments
+     * @param[in]  session        Session supplying the key
+     * @param[in]  sequence       Sequence number, used by no other frame
+     * @param[out] output         Output buffer for encoded frame
+     * @param[in,out] output_len  Input: buffer size, Output: encoded frame length
+     *
+     * @return ACP_OK on success, error code on failure
+     */
+    acp_result_t acp_encode_frame_seq(
+        uint8_t type,
+        const acp_iovec_t *payload,
+        size_t payload_count,
+        const acp_session_t *session,
+        uint64_t sequence,
+        uint8_t *output,
+        size_t *output_len);
+
+    /**
+     * @brief Encode several frames back to back into one buffer
+     *
+     * Frames are packed contiguously so the whole batch can go out in one
+     * write. Sequence numbers for the authenticated frames are taken from
+     * the session as one consecutive block and the session is updated
+     * once. Encoding stops at the first frame that fails (e.g. the buffer
+     * is full); the frames before it are complete and may be sent, and only
+     * their sequence numbers are consumed.
+     *
+     * @param[in]  descs       Frames to encode
+     * @param[in]  count       Number of frames
+     * @param[in]  session     Session for authenticated frames (NULL if none)
+     * @param[out] output      Output buffer
+     * @param[in]  output_size Size of output buffer
+     * @param[out] offsets     Start offset of each encoded frame (count entries, may be NULL)
+     * @param[out] encoded     Number of frames encoded
+     * @param[out] output_len  Total bytes written
+     *
+     * @return ACP_OK if every frame was encoded, otherwise the error of the
+     *         first frame that was not
+     */
+    acp_result_t acp_encode_batch(
+        const acp_encode_desc_t *descs,
+        size_t count,
+        acp_session_t *session,
+        uint8_t *output,
+        size_t output_size,
+        size_t *offsets,
+        size_t *encoded,
+        size_t *output_len);
+
+    /**
+     * @brief Decode every complete frame in a receive buffer
+     *
+     * Splits the buffer at frame delimiters and decodes, CRC-checks and
+     * authenticates each complete frame into @p decode_buf, packing the
+     * decoded frames back to back. A frame that fails gets a result entry
+     * with its error code and the batch carries on with the next frame;
+     * bytes outside any frame are skipped. Decoding stops at an incomplete
+     * trailing frame, when @p max_results entries are filled, or when less
+     * than ACP_DECODE_BUFFER_SIZE of @p decode_buf is left.
+     *
+     * @param[in]  input           Receive buffer
+     * @param[in]  input_len       Length of receive buffer
+     * @param[out] decode_buf      Buffer receiving the decoded frames
+     * @param[in]  decode_buf_size Size of decode buffer
+     * @param[out] results         Per-frame results, in stream order
+     * @param[in]  max_results     Number of entries in @p results
+     * @param[out] count           Number of entries filled
+     * @param[out] consumed        Input bytes processed; the rest (e.g. a
+     *                             partial frame) must be presented again
+     * @param[in]  session         Session for authentication (NULL for unauthenticated)
+     *
+     * @return ACP_OK (per-frame errors are reported in @p results),
+     *         ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_decode_batch(
+        const uint8_t *input,
+        size_t input_len,
+        uint8_t *decode_buf,
+        size_t decode_buf_size,
+        acp_decode_result_t *results,
+        size_t max_results,
+        size_t *count,
+        size_t *consumed,
+        acp_session_t *session);
+
     /**
      * @brief Decode an ACP frame from stream
      *
@@ -296,10 +526,15 @@ extern "C"
      * @param[in]  input         Input stream buffer
      * @param[in]  input_len     Length of input data
      * @param[out] frame         Decoded frame structure
-     * @param[out] consumed      Number of input bytes consumed
+     * @param[out] consumed      Number of input bytes consumed; on a framing
+     *                           error, the bytes up to the next delimiter
      * @param[in]  session       Session for authentication (NULL for unauthenticated)
      *
      * @return ACP_OK on success, ACP_ERR_NEED_MORE_DATA if incomplete, other error codes on failure
+     *
+     * @note After an error, skip @p consumed bytes (at least one if it is
+     *       zero) and call again: noise and damaged frames are passed over
+     *       in a single step, so each byte is scanned a bounded number of times.
      */
     acp_result_t acp_decode_frame(
         const uint8_t *input,
@@ -308,6 +543,335 @@ extern "C"
         size_t *consumed,
         acp_session_t *session);
 
+    /**
+     * @brief Decode an ACP frame from stream without copying the payload
+     *
+     * Behaves like acp_decode_frame(), but COBS-decodes into the caller-owned
+     * @p decode_buf and returns a view whose payload pointer refers into it.
+     *
+     * @param[in]  input           Input stream buffer
+     * @param[in]  input_len       Length of input data
+     * @param[out] decode_buf      Caller-owned buffer receiving the decoded frame
+     * @param[in]  decode_buf_size Size of decode buffer (ACP_DECODE_BUFFER_SIZE suffices)
+     * @param[out] view            Decoded frame view
+     * @param[out] consumed        Number of input bytes consumed
+     * @param[in]  session         Session for authentication (NULL for unauthenticated)
+     *
+     * @return ACP_OK on success, ACP_ERR_NEED_MORE_DATA if incomplete, other error codes on failure
+     */
+    acp_result_t acp_decode_frame_view(
+        const uint8_t *input,
+        size_t input_len,
+        uint8_t *decode_buf,
+        size_t decode_buf_size,
+        acp_frame_view_t *view,
+        size_t *consumed,
+        acp_session_t *session);
+
+    /**
+     * @brief Decode an ACP frame from input split across two spans
+     *
+     * Behaves like acp_decode_frame_view() on the concatenation of @p head
+     * and @p tail, for receive buffers that wrap around (e.g. a circular DMA
+     * buffer, where head runs to the end of the buffer and tail continues
+     * from its start). COBS, CRC16 and HMAC all run across the seam; the
+     * frame is never copied to make it contiguous. Only an HMAC tag that is
+     * itself split by the seam is gathered into @p decode_buf, which then
+     * needs ACP_HMAC_TAG_LEN bytes beyond the decoded frame.
+     *
+     * @param[in]  head            First span, starting at the frame
+     * @param[in]  head_len        Length of first span
+     * @param[in]  tail            Second span, continuing the first (NULL if empty)
+     * @param[in]  tail_len        Length of second span
+     * @param[out] decode_buf      Caller-owned buffer receiving the decoded frame
+     * @param[in]  decode_buf_size Size of decode buffer (ACP_DECODE_BUFFER_SIZE suffices)
+     * @param[out] view            Decoded frame view
+     * @param[out] consumed        Number of input bytes consumed across both spans
+     * @param[in]  session         Session for authentication (NULL for unauthenticated)
+     *
+     * @return ACP_OK on success, ACP_ERR_NEED_MORE_DATA if incomplete, other error codes on failure
+     */
+    acp_result_t acp_decode_frame_split(
+        const uint8_t *head,
+        size_t head_len,
+        const uint8_t *tail,
+        size_t tail_len,
+        uint8_t *decode_buf,
+        size_t decode_buf_size,
+        acp_frame_view_t *view,
+        size_t *consumed,
+        acp_session_t *session);
+
+    /* ========================================================================== */
+    /*                           Zero-Copy Transmit                               */
+    /* ========================================================================== */
+
+/**
+ * @brief Space ahead of the payload in a TX reservation
+ *
+ * Room for the opening delimiter, the largest wire header and every COBS
+ * code byte, so the frame can be stuffed in place without the encoded
+ * output ever overtaking the payload bytes still to be read.
+ */
+#define ACP_TX_HEADROOM(max_payload) \
+    (2 + sizeof(acp_wire_header_t) + ACP_COBS_OVERHEAD(sizeof(acp_wire_header_t) + (max_payload) + 2))
+
+/** @brief Buffer space taken by a TX reservation for @p max_payload bytes */
+#define ACP_TX_RESERVE_SIZE(max_payload) \
+    (ACP_TX_HEADROOM(max_payload) + (max_payload) + 2 + ACP_HMAC_TAG_LEN)
+
+    /**
+     * @brief Transmit buffer that frames are encoded into in place
+     *
+     * Complete frames are packed back to back at the start of the buffer,
+     * ready to be written out in one go.
+     */
+    typedef struct
+    {
+        uint8_t *buffer;        /**< Transmit buffer (caller-owned) */
+        size_t size;            /**< Transmit buffer size */
+        size_t length;          /**< Bytes of complete frames at the start of buffer */
+        size_t reserved;        /**< Size of the outstanding reservation, 0 if none */
+        acp_session_t *session; /**< Session for authenticated frames (may be NULL) */
+    } acp_tx_buffer_t;
+
+    /**
+     * @brief Writable payload region handed out by acp_tx_reserve()
+     */
+    typedef struct
+    {
+        acp_tx_buffer_t *tx; /**< Buffer the span belongs to */
+        uint8_t *payload;    /**< Where the producer writes the payload */
+        size_t max_payload;  /**< Capacity of payload region */
+    } acp_tx_span_t;
+
+    /**
+     * @brief Initialize a transmit buffer
+     *
+     * @param[out] tx      Transmit buffer to initialize
+     * @param[in]  buffer  Caller-owned storage for encoded frames
+     * @param[in]  size    Size of storage
+     * @param[in]  session Session for authenticated frames (NULL if none)
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_tx_init(acp_tx_buffer_t *tx, uint8_t *buffer, size_t size, acp_session_t *session);
+
+    /**
+     * @brief Reserve space for the next frame's payload
+     *
+     * Hands out a region inside the transmit buffer, after the frames
+     * already committed and with ACP_TX_HEADROOM() in front of it, for the
+     * producer to build the payload in. Only one reservation may be
+     * outstanding; finish it with acp_tx_commit() or acp_tx_abort().
+     *
+     * @param[in,out] tx          Transmit buffer
+     * @param[in]     max_payload Largest payload the producer may write
+     * @param[out]    span        Writable payload region
+     *
+     * @return ACP_OK on success, ACP_ERR_PAYLOAD_TOO_LARGE if @p max_payload
+     *         exceeds ACP_MAX_PAYLOAD_SIZE, ACP_ERR_BUFFER_TOO_SMALL if the
+     *         buffer lacks ACP_TX_RESERVE_SIZE() bytes, ACP_ERR_INVALID_PARAM
+     *         if a reservation is already outstanding
+     */
+    acp_result_t acp_tx_reserve(acp_tx_buffer_t *tx, size_t max_payload, acp_tx_span_t *span);
+
+    /**
+     * @brief Turn a filled reservation into a frame
+     *
+     * Writes the header, folds header and payload into the CRC, COBS-stuffs
+     * the frame over the reservation in place and appends the HMAC tag for
+     * authenticated frames. The payload is never copied to another buffer.
+     * On success the frame is appended to the buffer's length; on failure
+     * the reservation is released and the buffer is unchanged.
+     *
+     * @param[in,out] span  Reservation from acp_tx_reserve()
+     * @param[in]     type  Frame type (acp_frame_type_t)
+     * @param[in]     flags Frame flags (ACP_FLAG_*)
+     * @param[in]     len   Payload bytes written (at most span->max_payload)
+     *
+     * @return ACP_OK on success, error code on failure
+     */
+    acp_result_t acp_tx_commit(acp_tx_span_t *span, uint8_t type, uint8_t flags, size_t len);
+
+    /**
+     * @brief Release a reservation without producing a frame
+     *
+     * @param[in,out] span Reservation from acp_tx_reserve()
+     */
+    void acp_tx_abort(acp_tx_span_t *span);
+
+    /**
+     * @brief Discard committed frames once they have been written out
+     *
+     * @param[in,out] tx Transmit buffer
+     */
+    void acp_tx_reset(acp_tx_buffer_t *tx);
+
+    /* ========================================================================== */
+    /*                          Incremental Decoding                              */
+    /* ========================================================================== */
+
+/** @brief Work buffer size for acp_decoder_init() (decoded frame + encoded image) */
+#define ACP_DECODER_BUFFER_SIZE (2 * ACP_MAX_FRAME_SIZE)
+
+    /**
+     * @brief Incremental decoder states
+     */
+    typedef enum
+    {
+        ACP_DECODER_HUNT,  /**< Skipping bytes until an opening delimiter */
+        ACP_DECODER_FRAME, /**< Un-stuffing COBS data between delimiters */
+        ACP_DECODER_TAG    /**< Collecting the raw HMAC tag after the frame */
+    } acp_decoder_state_t;
+
+    /**
+     * @brief Resumable frame decoder
+     *
+     * Keeps partial COBS block state and the running CRC16 between calls, so
+     * each input byte is examined exactly once no matter how the link splits
+     * the stream. Input handed to acp_decoder_decode() is absorbed and need
+     * not be retained by the caller. After noise or a damaged frame the
+     * decoder resumes at the next delimiter without rescanning, and counts
+     * what it discarded.
+     */
+    typedef struct
+    {
+        uint8_t *frame_buf;             /**< Decoded frame (caller-owned) */
+        size_t frame_buf_size;          /**< Decoded frame capacity */
+        uint8_t *wire_buf;              /**< Encoded frame image for HMAC (caller-owned) */
+        size_t wire_buf_size;           /**< Encoded image capacity */
+        size_t frame_len;               /**< Bytes decoded so far */
+        size_t wire_len;                /**< Encoded bytes received so far */
+        size_t crc_len;                 /**< Decoded bytes folded into crc */
+        uint16_t crc;                   /**< Running CRC16 state */
+        uint8_t block_remaining;        /**< Data bytes left in the current COBS block */
+        bool zero_pending;              /**< Current block ends in an implicit zero */
+        size_t tag_len;                 /**< HMAC tag bytes collected */
+        uint8_t tag[ACP_HMAC_TAG_LEN];  /**< Received HMAC tag */
+        acp_decoder_state_t state;      /**< Decoder state */
+        uint64_t bytes_skipped;         /**< Noise and rejected-frame bytes discarded */
+        uint32_t frames_rejected;       /**< Frames that completed but were rejected */
+    } acp_decoder_t;
+
+    /**
+     * @brief Initialize an incremental decoder
+     *
+     * @param[out] decoder     Decoder to initialize
+     * @param[in]  buffer      Caller-owned work buffer
+     * @param[in]  buffer_size Size of work buffer (ACP_DECODER_BUFFER_SIZE suffices)
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_decoder_init(acp_decoder_t *decoder, uint8_t *buffer, size_t buffer_size);
+
+    /**
+     * @brief Discard any partial frame and wait for the next opening delimiter
+     *
+     * @param[in,out] decoder Decoder to reset
+     */
+    void acp_decoder_reset(acp_decoder_t *decoder);
+
+    /**
+     * @brief Feed stream bytes to the decoder until a frame completes
+     *
+     * Processes @p input from the start and stops after the first complete
+     * frame. Call again with the remaining @p input_len - @p consumed bytes to
+     * pick up further frames from the same chunk.
+     *
+     * @param[in,out] decoder   Decoder state
+     * @param[in]     input     Next chunk of the byte stream
+     * @param[in]     input_len Length of chunk
+     * @param[out]    consumed  Number of input bytes absorbed
+     * @param[out]    view      Decoded frame, valid until the next call
+     * @param[in]     session   Session for authentication (NULL for unauthenticated)
+     *
+     * @return ACP_OK when a frame completed, ACP_ERR_NEED_MORE_DATA when the
+     *         whole chunk was absorbed without completing one, other error
+     *         codes when the frame ending at @p consumed was rejected
+     */
+    acp_result_t acp_decoder_decode(
+        acp_decoder_t *decoder,
+        const uint8_t *input,
+        size_t input_len,
+        size_t *consumed,
+        acp_frame_view_t *view,
+        acp_session_t *session);
+
+    /* ========================================================================== */
+    /*                          Push Parser                                       */
+    /* ========================================================================== */
+
+    /**
+     * @brief Frame handler: @p view is valid only for the duration of the call
+     */
+    typedef void (*acp_parser_frame_cb_t)(void *context, const acp_frame_view_t *view);
+
+    /**
+     * @brief Error handler: @p offset is the stream position just past the rejected bytes
+     */
+    typedef void (*acp_parser_error_cb_t)(void *context, acp_result_t error, uint64_t offset);
+
+    /**
+     * @brief Callback-driven stream parser
+     *
+     * Owns the decoder, its work buffer and the resync logic, so an
+     * integration only pushes received chunks and handles the callbacks.
+     * Chunks are absorbed as they arrive; unconsumed bytes are never moved.
+     * The decoder points into @c buffer, so a parser must not be copied.
+     */
+    typedef struct
+    {
+        acp_decoder_t decoder;                     /**< Incremental decoder */
+        acp_session_t *session;                    /**< Session for authentication (may be NULL) */
+        acp_parser_frame_cb_t on_frame;            /**< Called for each accepted frame */
+        acp_parser_error_cb_t on_error;            /**< Called for each rejected frame (may be NULL) */
+        void *context;                             /**< Passed to both callbacks */
+        uint64_t offset;                           /**< Stream bytes pushed so far */
+        uint8_t buffer[ACP_DECODER_BUFFER_SIZE];   /**< Decoder work buffer */
+    } acp_parser_t;
+
+    /**
+     * @brief Initialize a push parser
+     *
+     * @param[out] parser   Parser to initialize
+     * @param[in]  session  Session for authentication (NULL for unauthenticated)
+     * @param[in]  on_frame Frame handler
+     * @param[in]  on_error Error handler (NULL to ignore rejected frames)
+     * @param[in]  context  Opaque pointer passed to the handlers
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_parser_init(
+        acp_parser_t *parser,
+        acp_session_t *session,
+        acp_parser_frame_cb_t on_frame,
+        acp_parser_error_cb_t on_error,
+        void *context);
+
+    /**
+     * @brief Discard any partial frame and resynchronize on the next delimiter
+     *
+     * The stream offset keeps counting from where it was.
+     *
+     * @param[in,out] parser Parser to reset
+     */
+    void acp_parser_reset(acp_parser_t *parser);
+
+    /**
+     * @brief Push a chunk of the byte stream through the parser
+     *
+     * Every frame completed by @p data is delivered to the handlers before
+     * this returns. The chunk is fully absorbed and need not be retained.
+     *
+     * @param[in,out] parser Parser state
+     * @param[in]     data   Next chunk of the byte stream
+     * @param[in]     len    Length of chunk
+     *
+     * @return ACP_OK, or ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_parser_push(acp_parser_t *parser, const uint8_t *data, size_t len);
+
     /* ========================================================================== */
     /*                          Session Management                                */
     /* ========================================================================== */
@@ -346,6 +910,178 @@ extern "C"
         size_t new_key_len,
         uint64_t new_nonce);
 
+    /**
+     * @brief Get the key identifier a session was initialized with
+     *
+     * @param[in] session Session to query
+     *
+     * @return Key identifier, or 0 if @p session is NULL
+     */
+    uint32_t acp_session_get_key_id(const acp_session_t *session);
+
+    /**
+     * @brief Get the sequence number the next authenticated frame will use
+     *
+     * Safe to call while other threads send in concurrent transmit mode;
+     * the value may then be stale by the time it is returned.
+     *
+     * @param[in] session Session to query
+     *
+     * @return Next transmit sequence number, or 0 if @p session is NULL
+     */
+    uint64_t acp_session_get_next_sequence(const acp_session_t *session);
+
+    /**
+     * @brief Set the sequence number for the next authenticated frame
+     *
+     * For resuming a session from saved state. Must not race with senders.
+     *
+     * @param[in,out] session  Session to update
+     * @param[in]     sequence Next transmit sequence number (non-zero)
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM on NULL or zero
+     */
+    acp_result_t acp_session_set_next_sequence(acp_session_t *session, uint64_t sequence);
+
+    /**
+     * @brief Get the highest sequence number accepted so far
+     *
+     * @param[in] session Session to query
+     *
+     * @return Highest accepted sequence number, or 0 if none or @p session is NULL
+     */
+    uint64_t acp_session_get_last_accepted(const acp_session_t *session);
+
+    /**
+     * @brief Set the highest sequence number accepted so far
+     *
+     * For resuming a session from saved state: only sequence numbers above
+     * @p sequence are accepted afterwards, and the replay window forgets
+     * which ones below it were seen. Must not race with the receiver.
+     *
+     * @param[in,out] session  Session to update
+     * @param[in]     sequence Highest accepted sequence number
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM if @p session is NULL
+     */
+    acp_result_t acp_session_set_last_accepted(acp_session_t *session, uint64_t sequence);
+
+    /**
+     * @brief Accept out-of-order sequence numbers within a sliding window
+     *
+     * By default a session accepts only strictly increasing sequence
+     * numbers, so a frame overtaken by a later one is dropped. With a
+     * window of @p bits, any sequence number within @p bits of the highest
+     * one accepted so far is accepted once, in any order; older ones and
+     * repeats are still rejected with ACP_ERR_REPLAY. Changing the window
+     * forgets which sequence numbers below the highest were seen.
+     *
+     * @param[in,out] session Session to configure
+     * @param[in]     bits    0 for strict ordering, or a multiple of 64 from
+     *                        ACP_REPLAY_WINDOW_MIN to ACP_REPLAY_WINDOW_MAX
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM on a bad window size
+     */
+    acp_result_t acp_session_set_replay_window(acp_session_t *session, uint16_t bits);
+
+    /**
+     * @brief Check a received sequence number and record it as seen
+     *
+     * Applies the session's replay policy; call only once the frame
+     * carrying @p sequence has been authenticated.
+     *
+     * @param[in,out] session  Receiving session
+     * @param[in]     sequence Sequence number from an authenticated frame
+     *
+     * @return ACP_OK if accepted, ACP_ERR_REPLAY if a repeat, too old or zero
+     */
+    acp_result_t acp_session_accept_sequence(acp_session_t *session, uint64_t sequence);
+
+    /**
+     * @brief Enable or disable extended (64-bit) sequence numbers
+     *
+     * Frames still carry only the low 32 bits of the sequence number; the
+     * receiver infers the high bits from the highest sequence number it
+     * has accepted, and the HMAC covers them, so both ends must use the
+     * same setting. Without extended sequence numbers a session refuses to
+     * send once the 32-bit space is used up (ACP_ERR_SESSION_EXPIRED) and
+     * must be rotated; with them it can run indefinitely.
+     *
+     * @param[in,out] session Session to configure
+     * @param[in]     enable  true for 64-bit sequence numbers
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM if @p session is NULL
+     */
+    acp_result_t acp_session_set_extended_sequence(acp_session_t *session, bool enable);
+
+    /**
+     * @brief Allocate transmit sequence numbers atomically
+     *
+     * With concurrent transmit enabled, acp_encode_frame(), its variants
+     * and acp_tx_commit() take each sequence number with an atomic
+     * fetch-add, so threads may encode on one session without a lock
+     * around the HMAC and COBS work. A sequence number taken by an encode
+     * that then fails is skipped. When disabled (the default), the counter
+     * is advanced only by successful encodes and must not be shared
+     * between threads.
+     *
+     * @param[in,out] session Session to configure
+     * @param[in]     enable  true to allocate atomically
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM if @p session is NULL
+     */
+    acp_result_t acp_session_set_concurrent_tx(acp_session_t *session, bool enable);
+
+    /**
+     * @brief Reserve a block of consecutive transmit sequence numbers
+     *
+     * Always atomic, whatever the concurrent transmit setting.
+     *
+     * @param[in,out] session Session to allocate from
+     * @param[in]     count   Number of sequence numbers (at least 1)
+     * @param[out]    first   First number of the block
+     *
+     * @return ACP_OK on success, ACP_ERR_SESSION_EXPIRED if the block runs
+     *         past the 32-bit space without extended sequence numbers,
+     *         ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_session_reserve_sequences(acp_session_t *session, uint32_t count, uint64_t *first);
+
+    /**
+     * @brief Initialize a per-thread sequence block
+     *
+     * @param[out] block   Block to initialize (starts empty)
+     * @param[in]  session Session to draw numbers from
+     * @param[in]  size    Numbers reserved per refill (at least 1)
+     *
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_seq_block_init(acp_seq_block_t *block, acp_session_t *session, uint32_t size);
+
+    /**
+     * @brief Take the next sequence number from a block, refilling it if empty
+     *
+     * @param[in,out] block    Block owned by the calling thread
+     * @param[out]    sequence Sequence number for acp_encode_frame_seq()
+     *
+     * @return ACP_OK on success, or the error from acp_session_reserve_sequences()
+     */
+    acp_result_t acp_seq_block_take(acp_seq_block_t *block, uint64_t *sequence);
+
+    /**
+     * @brief Reconstruct a full sequence number from its low 32 bits
+     *
+     * Picks the value nearest the highest sequence number accepted so far,
+     * so frames up to 2^31 behind it or ahead of it are placed correctly.
+     * Returns @p wire_sequence unchanged without extended sequence numbers.
+     *
+     * @param[in] session       Receiving session
+     * @param[in] wire_sequence Sequence number field from the frame
+     *
+     * @return Full sequence number to authenticate and check for replay
+     */
+    uint64_t acp_session_infer_sequence(const acp_session_t *session, uint32_t wire_sequence);
+
     /**
      * @brief Reset session sequence counters
      *
@@ -522,11 +1258,65 @@ extern "C"
      */
     int acp_frame_encode(const acp_frame_t *frame, uint8_t *output, size_t output_size, size_t *bytes_written);
 
+    /**
+     * @brief Encode a frame view to wire format
+     *
+     * Header, payload and CRC are streamed through the COBS stuffer directly
+     * into @p output, with the CRC computed inline; the payload is read once
+     * from wherever the view points and never staged.
+     */
+    int acp_frame_encode_view(const acp_frame_view_t *view, uint8_t *output, size_t output_size, size_t *bytes_written);
+
+    /**
+     * @brief Encode a frame whose payload is split across segments
+     *
+     * Like acp_frame_encode_view(), but the payload is streamed from
+     * @p payload_count segments in order; the view's payload and length
+     * fields are ignored and the length is the sum of the segments.
+     * A segment may lie inside @p output as long as it starts at least
+     * ACP_TX_HEADROOM() bytes into it, which is how acp_tx_commit()
+     * encodes in place.
+     */
+    int acp_frame_encode_iov(const acp_frame_view_t *view,
+                             const acp_iovec_t *payload, size_t payload_count,
+                             uint8_t *output, size_t output_size, size_t *bytes_written);
+
     /**
      * @brief Decode wire format to ACP frame
      */
     int acp_frame_decode(const uint8_t *input, size_t input_size, acp_frame_t *frame, size_t *bytes_consumed);
 
+    /**
+     * @brief Decode wire format to a zero-copy frame view
+     *
+     * The frame is COBS-decoded into @p decode_buf and the view's payload
+     * points into it; no further copy of the payload is made.
+     */
+    int acp_frame_decode_view(const uint8_t *input, size_t input_size,
+                              uint8_t *decode_buf, size_t decode_buf_size,
+                              acp_frame_view_t *view, size_t *bytes_consumed);
+
+    /**
+     * @brief Decode a zero-copy frame view from input split across two spans
+     *
+     * Like acp_frame_decode_view(), with the input being @p head followed by
+     * @p tail (e.g. a circular buffer's contents either side of the wrap).
+     * @p bytes_consumed counts bytes across both spans.
+     */
+    int acp_frame_decode_view_split(const uint8_t *head, size_t head_size,
+                                    const uint8_t *tail, size_t tail_size,
+                                    uint8_t *decode_buf, size_t decode_buf_size,
+                                    acp_frame_view_t *view, size_t *bytes_consumed);
+
+    /**
+     * @brief Parse an already COBS-decoded frame into a view
+     *
+     * Validates the header, length and CRC of @p decoded, where
+     * @p calculated_crc is the CRC16 over all but its last two bytes.
+     */
+    int acp_frame_parse_decoded(const uint8_t *decoded, size_t decoded_len,
+                                uint16_t calculated_crc, acp_frame_view_t *view);
+
     /**
      * @brief Calculate encoded frame size
      */
@@ -0,0 +1,160 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_ring.c
+ * @brief Lock-free single-producer/single-consumer byte ring
+ *
+ * The only synchronisation is a release store of each side's index after
+ * touching the data and an acquire load of the other side's index before
+ * touching it. The copying calls re-read the other side's index only when
+ * their cached copy is too small for the request, so small writes and reads
+ * in steady state rarely pull the other core's line across.
+ */
+
+#include "acp_ring.h"
+#include "acp_errors.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                              Helpers                                       */
+/* ========================================================================== */
+
+/**
+ * @brief Describe ring span [start, start + len) as up to two regions
+ */
+static void ring_regions(const acp_ring_t *ring, size_t start, size_t len, acp_ring_regions_t *regions)
+{
+    size_t offset = start & (ring->size - 1);
+    size_t first = ring->size - offset;
+    if (first > len)
+    {
+        first = len;
+    }
+
+    regions->first = ring->buffer + offset;
+    regions->first_len = first;
+    regions->second = ring->buffer;
+    regions->second_len = len - first;
+}
+
+/* ========================================================================== */
+/*                              Functions                                     */
+/* ========================================================================== */
+
+int acp_ring_init(acp_ring_t *ring, uint8_t *storage, size_t size)
+{
+    if (!ring || !storage || size < 2 || (size & (size - 1)) != 0)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    ring->buffer = storage;
+    ring->size = size;
+    return ACP_OK;
+}
+
+size_t acp_ring_write_regions(acp_ring_t *ring, acp_ring_regions_t *regions)
+{
+    size_t head = ACP_ATOMIC_LOAD_RELAXED(&ring->head);
+    ring->tail_cache = ACP_ATOMIC_LOAD_ACQUIRE(&ring->tail);
+    size_t free_bytes = ring->size - (head - ring->tail_cache);
+
+    ring_regions(ring, head, free_bytes, regions);
+    return free_bytes;
+}
+
+void acp_ring_produce(acp_ring_t *ring, size_t len)
+{
+    size_t head = ACP_ATOMIC_LOAD_RELAXED(&ring->head);
+    ACP_ATOMIC_STORE_RELEASE(&ring->head, head + len);
+}
+
+size_t acp_ring_write(acp_ring_t *ring, const uint8_t *data, size_t len)
+{
+    size_t head = ACP_ATOMIC_LOAD_RELAXED(&ring->head);
+    size_t free_bytes = ring->size - (head - ring->tail_cache);
+    if (free_bytes < len)
+    {
+        /* Cached view too small: fetch the consumer's progress */
+        ring->tail_cache = ACP_ATOMIC_LOAD_ACQUIRE(&ring->tail);
+        free_bytes = ring->size - (head - ring->tail_cache);
+        if (len > free_bytes)
+        {
+            len = free_bytes;
+        }
+    }
+
+    acp_ring_regions_t regions;
+    ring_regions(ring, head, len, &regions);
+    memcpy(regions.first, data, regions.first_len);
+    memcpy(regions.second, data + regions.first_len, regions.second_len);
+    ACP_ATOMIC_STORE_RELEASE(&ring->head, head + len);
+    return len;
+}
+
+size_t acp_ring_read_regions(acp_ring_t *ring, acp_ring_regions_t *regions)
+{
+    size_t tail = ACP_ATOMIC_LOAD_RELAXED(&ring->tail);
+    ring->head_cache = ACP_ATOMIC_LOAD_ACQUIRE(&ring->head);
+    size_t used = ring->head_cache - tail;
+
+    ring_regions(ring, tail, used, regions);
+    return used;
+}
+
+void acp_ring_consume(acp_ring_t *ring, size_t len)
+{
+    size_t tail = ACP_ATOMIC_LOAD_RELAXED(&ring->tail);
+    ACP_ATOMIC_STORE_RELEASE(&ring->tail, tail + len);
+}
+
+size_t acp_ring_read(acp_ring_t *ring, uint8_t *data, size_t len)
+{
+    size_t tail = ACP_ATOMIC_LOAD_RELAXED(&ring->tail);
+    size_t used = ring->head_cache - tail;
+    if (used < len)
+    {
+        /* Cached view too small: fetch the producer's progress */
+        ring->head_cache = ACP_ATOMIC_LOAD_ACQUIRE(&ring->head);
+        used = ring->head_cache - tail;
+        if (len > used)
+        {
+            len = used;
+        }
+    }
+
+    acp_ring_regions_t regions;
+    ring_regions(ring, tail, len, &regions);
+    memcpy(data, regions.first, regions.first_len);
+    memcpy(data + regions.first_len, regions.second, regions.second_len);
+    ACP_ATOMIC_STORE_RELEASE(&ring->tail, tail + len);
+    return len;
+}
+
+size_t acp_ring_used(const acp_ring_t *ring)
+{
+    size_t tail = ACP_ATOMIC_LOAD_ACQUIRE(&ring->tail);
+    size_t head = ACP_ATOMIC_LOAD_ACQUIRE(&ring->head);
+    return head - tail;
+}
@@ -0,0 +1,186 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_ring.h
+ * @brief Lock-free single-producer/single-consumer byte ring
+ *
+ * Decouples byte ingest from frame parsing: an I/O thread (or an ISR on
+ * MCU targets) appends received bytes while the parser drains them on
+ * another core, neither side ever blocking on the other. The producer and
+ * consumer indices live on separate cache lines so the two cores do not
+ * contend for the same line on every update.
+ *
+ * Both sides can work on the ring storage in place: the producer asks for
+ * the free space as up to two regions (e.g. for read() or DMA), and the
+ * consumer gets the readable bytes as up to two regions, which map
+ * directly onto acp_decode_frame_split() or successive
+ * acp_decoder_decode() calls.
+ *
+ * @version 0.3.0
+ * @date 2025-10-27
+ */
+
+#ifndef ACP_RING_H
+#define ACP_RING_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "acp_config.h"
+
+    /* ========================================================================== */
+    /*                              Types                                         */
+    /* ========================================================================== */
+
+    /**
+     * @brief SPSC byte ring
+     *
+     * head and tail are free-running byte counts; only the producer writes
+     * head and only the consumer writes tail. Each side keeps a cached copy
+     * of the other's index; the copying calls re-read the shared one only
+     * when the cache cannot satisfy the request, while the region calls
+     * always report the latest state.
+     */
+    typedef struct
+    {
+        /* Producer cache line */
+        ACP_CACHE_ALIGNED size_t head; /**< Bytes produced (written by producer) */
+        size_t tail_cache;             /**< Producer's last view of tail */
+        uint8_t producer_pad[ACP_CACHE_LINE_SIZE - 2 * sizeof(size_t)];
+
+        /* Consumer cache line */
+        ACP_CACHE_ALIGNED size_t tail; /**< Bytes consumed (written by consumer) */
+        size_t head_cache;             /**< Consumer's last view of head */
+        uint8_t consumer_pad[ACP_CACHE_LINE_SIZE - 2 * sizeof(size_t)];
+
+        /* Read-only after init */
+        ACP_CACHE_ALIGNED uint8_t *buffer; /**< Ring storage (caller-owned) */
+        size_t size;                       /**< Storage size, a power of two */
+    } acp_ring_t;
+
+    /**
+     * @brief Ring contents or free space as at most two contiguous regions
+     *
+     * The second region is non-empty only when the span wraps past the end
+     * of the storage.
+     */
+    typedef struct
+    {
+        uint8_t *first;     /**< First region */
+        size_t first_len;   /**< Length of first region */
+        uint8_t *second;    /**< Continuation at the start of storage */
+        size_t second_len;  /**< Length of second region */
+    } acp_ring_regions_t;
+
+    /* ========================================================================== */
+    /*                              Functions                                     */
+    /* ========================================================================== */
+
+    /**
+     * @brief Initialize a ring over caller-provided storage
+     *
+     * Must not race with either side; the ring starts empty.
+     *
+     * @param ring Ring to initialize
+     * @param storage Ring storage
+     * @param size Storage size in bytes (a power of two, at least 2)
+     * @return 0 on success, ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    int acp_ring_init(acp_ring_t *ring, uint8_t *storage, size_t size);
+
+    /**
+     * @brief Append bytes to the ring (producer)
+     *
+     * Copies as much of @p data as fits and returns at once; never waits.
+     *
+     * @param ring Ring
+     * @param data Bytes to append
+     * @param len Number of bytes
+     * @return Number of bytes appended
+     */
+    size_t acp_ring_write(acp_ring_t *ring, const uint8_t *data, size_t len);
+
+    /**
+     * @brief Get the free space for writing in place (producer)
+     *
+     * @param ring Ring
+     * @param regions Returns the free space, first region first
+     * @return Total free bytes
+     */
+    size_t acp_ring_write_regions(acp_ring_t *ring, acp_ring_regions_t *regions);
+
+    /**
+     * @brief Publish bytes written in place to the consumer (producer)
+     *
+     * @param ring Ring
+     * @param len Bytes written, at most the free space last reported
+     */
+    void acp_ring_produce(acp_ring_t *ring, size_t len);
+
+    /**
+     * @brief Remove bytes from the ring (consumer)
+     *
+     * @param ring Ring
+     * @param data Destination buffer
+     * @param len Maximum number of bytes to remove
+     * @return Number of bytes removed
+     */
+    size_t acp_ring_read(acp_ring_t *ring, uint8_t *data, size_t len);
+
+    /**
+     * @brief Get the readable bytes for processing in place (consumer)
+     *
+     * @param ring Ring
+     * @param regions Returns the readable bytes, oldest first
+     * @return Total readable bytes
+     */
+    size_t acp_ring_read_regions(acp_ring_t *ring, acp_ring_regions_t *regions);
+
+    /**
+     * @brief Release bytes processed in place back to the producer (consumer)
+     *
+     * @param ring Ring
+     * @param len Bytes processed, at most the readable bytes last reported
+     */
+    void acp_ring_consume(acp_ring_t *ring, size_t len);
+
+    /**
+     * @brief Number of bytes currently in the ring
+     *
+     * Exact when called from either side's thread while the other is idle;
+     * otherwise a snapshot that may be stale by the time it returns.
+     *
+     * @param ring Ring
+     * @return Readable bytes
+     */
+    size_t acp_ring_used(const acp_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACP_RING_H */
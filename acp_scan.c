@@ -0,0 +1,295 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_scan.c
+ * @brief Zero-byte scanning kernels for COBS framing
+ *
+ * @version 0.3.0
+ * @date 2025-10-27
+ */
+
+#include "acp_scan.h"
+#include "acp_cpu.h"
+#include "acp_errors.h"
+#include <string.h>
+
+#ifdef ACP_HAVE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#ifdef ACP_HAVE_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+typedef size_t (*acp_scan_fn_t)(const uint8_t *data, size_t len);
+
+/* ========================================================================== */
+/*                              Portable Kernels                              */
+/* ========================================================================== */
+
+/**
+ * @brief Byte-at-a-time reference kernel
+ */
+static size_t scan_zero_scalar(const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (data[i] == 0)
+        {
+            return i;
+        }
+    }
+    return len;
+}
+
+#define SWAR_ONES 0x0101010101010101ULL
+#define SWAR_HIGHS 0x8080808080808080ULL
+
+/**
+ * @brief SIMD-within-a-register kernel, 8 bytes per step
+ *
+ * (v - 0x01..01) & ~v & 0x80..80 is non-zero iff some byte of v is zero.
+ * Borrows can only flag bytes above the first zero, so on little-endian
+ * the lowest set bit locates it exactly.
+ */
+static size_t scan_zero_swar(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        uint64_t v;
+        memcpy(&v, data + i, sizeof(v));
+        uint64_t hit = (v - SWAR_ONES) & ~v & SWAR_HIGHS;
+        if (hit)
+        {
+#if defined(ACP_LITTLE_ENDIAN) && defined(ACP_COMPILER_GCC)
+            return i + (size_t)(__builtin_ctzll(hit) >> 3);
+#else
+            break;
+#endif
+        }
+    }
+    return i + scan_zero_scalar(data + i, len - i);
+}
+
+/* ========================================================================== */
+/*                              x86 Kernels                                   */
+/* ========================================================================== */
+
+#ifdef ACP_HAVE_X86_KERNELS
+
+/**
+ * @brief SSE2 kernel, 16 bytes per step
+ */
+__attribute__((target("sse2"))) static size_t scan_zero_sse2(const uint8_t *data, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero));
+        if (mask)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    return i + scan_zero_scalar(data + i, len - i);
+}
+
+/**
+ * @brief AVX2 kernel, 64 bytes per step with 32- and 16-byte tail steps
+ *
+ * The tail stays inside this function: calling the legacy-encoded SSE2
+ * kernel with dirty upper YMM state would incur a transition penalty.
+ */
+__attribute__((target("avx2"))) static size_t scan_zero_avx2(const uint8_t *data, size_t len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64)
+    {
+        __m256i a = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(data + i)), zero);
+        __m256i b = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(data + i + 32)), zero);
+        if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_or_si256(a, b)))
+        {
+            uint64_t mask = (uint32_t)_mm256_movemask_epi8(a) |
+                            ((uint64_t)(uint32_t)_mm256_movemask_epi8(b) << 32);
+            return i + (size_t)__builtin_ctzll(mask);
+        }
+    }
+    if (i + 32 <= len)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero));
+        if (mask)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+        i += 32;
+    }
+    if (i + 16 <= len)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+        if (mask)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+        i += 16;
+    }
+    for (; i < len; i++)
+    {
+        if (data[i] == 0)
+        {
+            return i;
+        }
+    }
+    return len;
+}
+
+#endif /* ACP_HAVE_X86_KERNELS */
+
+/* ========================================================================== */
+/*                              ARM Kernels                                   */
+/* ========================================================================== */
+
+#ifdef ACP_HAVE_NEON_KERNELS
+
+/**
+ * @brief NEON kernel, 16 bytes per step
+ *
+ * The byte-compare mask is narrowed to 4 bits per byte so it fits in one
+ * 64-bit lane for the bit scan.
+ */
+static size_t scan_zero_neon(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        uint8x16_t eq = vceqzq_u8(vld1q_u8(data + i));
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+        if (mask)
+        {
+            return i + (size_t)(__builtin_ctzll(mask) >> 2);
+        }
+    }
+    return i + scan_zero_scalar(data + i, len - i);
+}
+
+#endif /* ACP_HAVE_NEON_KERNELS */
+
+/* ========================================================================== */
+/*                              Dispatch                                      */
+/* ========================================================================== */
+
+static size_t scan_zero_resolve(const uint8_t *data, size_t len);
+
+/** @brief Active kernel; starts at a resolver that installs the best one from any thread */
+static acp_scan_fn_t scan_zero_impl = scan_zero_resolve;
+static acp_scan_kernel_t scan_kernel = ACP_SCAN_KERNEL_AUTO;
+
+/**
+ * @brief Kernel entry point if compiled in and supported by the CPU
+ */
+static acp_scan_fn_t scan_kernel_fn(acp_scan_kernel_t kernel)
+{
+    uint32_t features = acp_cpu_features();
+    (void)features;
+
+    switch (kernel)
+    {
+    case ACP_SCAN_KERNEL_SCALAR:
+        return scan_zero_scalar;
+    case ACP_SCAN_KERNEL_SWAR:
+        return scan_zero_swar;
+#ifdef ACP_HAVE_X86_KERNELS
+    case ACP_SCAN_KERNEL_SSE2:
+        return (features & ACP_CPU_SSE2) ? scan_zero_sse2 : NULL;
+    case ACP_SCAN_KERNEL_AVX2:
+        return (features & ACP_CPU_AVX2) ? scan_zero_avx2 : NULL;
+#endif
+#ifdef ACP_HAVE_NEON_KERNELS
+    case ACP_SCAN_KERNEL_NEON:
+        return (features & ACP_CPU_NEON) ? scan_zero_neon : NULL;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+static size_t scan_zero_resolve(const uint8_t *data, size_t len)
+{
+    acp_scan_set_kernel(ACP_SCAN_KERNEL_AUTO);
+    return ACP_ATOMIC_LOAD_RELAXED(&scan_zero_impl)(data, len);
+}
+
+size_t acp_scan_zero(const uint8_t *data, size_t len)
+{
+    return ACP_ATOMIC_LOAD_RELAXED(&scan_zero_impl)(data, len);
+}
+
+int acp_scan_set_kernel(acp_scan_kernel_t kernel)
+{
+    if (kernel == ACP_SCAN_KERNEL_AUTO)
+    {
+        /* Widest available first */
+        static const acp_scan_kernel_t preference[] = {
+            ACP_SCAN_KERNEL_AVX2, ACP_SCAN_KERNEL_SSE2, ACP_SCAN_KERNEL_NEON, ACP_SCAN_KERNEL_SWAR};
+        for (size_t i = 0; i < sizeof(preference) / sizeof(preference[0]); i++)
+        {
+            if (scan_kernel_fn(preference[i]) != NULL)
+            {
+                kernel = preference[i];
+                break;
+            }
+        }
+    }
+
+    acp_scan_fn_t fn = scan_kernel_fn(kernel);
+    if (fn == NULL)
+    {
+        return ACP_ERR_NOT_IMPLEMENTED;
+    }
+
+    ACP_ATOMIC_STORE_RELAXED(&scan_kernel, kernel);
+    ACP_ATOMIC_STORE_RELAXED(&scan_zero_impl, fn);
+    return ACP_OK;
+}
+
+acp_scan_kernel_t acp_scan_get_kernel(void)
+{
+    if (ACP_ATOMIC_LOAD_RELAXED(&scan_kernel) == ACP_SCAN_KERNEL_AUTO)
+    {
+        acp_scan_set_kernel(ACP_SCAN_KERNEL_AUTO);
+    }
+    return ACP_ATOMIC_LOAD_RELAXED(&scan_kernel);
+}
+
+const char *acp_scan_kernel_name(acp_scan_kernel_t kernel)
+{
+    static const char *const names[ACP_SCAN_KERNEL_COUNT] = {
+        "auto", "scalar", "swar", "sse2", "avx2", "neon"};
+    return (kernel < ACP_SCAN_KERNEL_COUNT) ? names[kernel] : "unknown";
+}
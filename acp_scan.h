@@ -0,0 +1,106 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_scan.h
+ * @brief Zero-byte scanning kernels for COBS framing
+ *
+ * Finding the next zero byte is the inner loop of COBS encoding (block
+ * boundaries) and of stream decoding (frame delimiters). This module
+ * provides SSE2, AVX2 and NEON kernels and a portable SWAR fallback behind
+ * a single entry point that dispatches on the running CPU.
+ *
+ * @version 0.3.0
+ * @date 2025-10-27
+ */
+
+#ifndef ACP_SCAN_H
+#define ACP_SCAN_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+    /* ========================================================================== */
+    /*                              Kernels                                       */
+    /* ========================================================================== */
+
+    /**
+     * @brief Zero-scan kernel identifiers
+     */
+    typedef enum
+    {
+        ACP_SCAN_KERNEL_AUTO = 0, /**< Best kernel for the running CPU */
+        ACP_SCAN_KERNEL_SCALAR,   /**< Byte-at-a-time reference */
+        ACP_SCAN_KERNEL_SWAR,     /**< Portable 8 bytes per step */
+        ACP_SCAN_KERNEL_SSE2,     /**< x86 SSE2, 16 bytes per step */
+        ACP_SCAN_KERNEL_AVX2,     /**< x86 AVX2, 64 bytes per step */
+        ACP_SCAN_KERNEL_NEON,     /**< ARM NEON, 16 bytes per step */
+        ACP_SCAN_KERNEL_COUNT
+    } acp_scan_kernel_t;
+
+    /* ========================================================================== */
+    /*                              Functions                                     */
+    /* ========================================================================== */
+
+    /**
+     * @brief Find the first zero byte
+     *
+     * @param data Data to scan
+     * @param len Length of data in bytes
+     * @return Index of the first zero byte, or @p len if there is none
+     */
+    size_t acp_scan_zero(const uint8_t *data, size_t len);
+
+    /**
+     * @brief Select the kernel used by acp_scan_zero()
+     *
+     * @param kernel Kernel to use (ACP_SCAN_KERNEL_AUTO for runtime detection)
+     * @return 0 on success, ACP_ERR_NOT_IMPLEMENTED if the kernel is not
+     *         available on this build or CPU
+     */
+    int acp_scan_set_kernel(acp_scan_kernel_t kernel);
+
+    /**
+     * @brief Get the kernel currently used by acp_scan_zero()
+     *
+     * @return Active kernel (never ACP_SCAN_KERNEL_AUTO)
+     */
+    acp_scan_kernel_t acp_scan_get_kernel(void);
+
+    /**
+     * @brief Get a printable kernel name
+     *
+     * @param kernel Kernel identifier
+     * @return Static name string
+     */
+    const char *acp_scan_kernel_name(acp_scan_kernel_t kernel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACP_SCAN_H */
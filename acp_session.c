@@ -32,6 +32,7 @@
 
 #include "acp_protocol.h" /* Contains session types and declarations */
 #include "acp_crypto.h"
+#include "acp_config.h"
 #include <string.h>
 
 /* ========================================================================== */
@@ -68,6 +69,7 @@ acp_result_t acp_session_init(acp_session_t *session,
     /* Copy authentication key (truncate to 32 bytes if needed) */
     size_t copy_len = (key_len > 32) ? 32 : key_len;
     memcpy(session->key, key, copy_len);
+    acp_hmac_midstate_init(&session->hmac, session->key, sizeof(session->key));
     session->nonce = nonce;
 
     return ACP_OK;
@@ -104,12 +106,14 @@ acp_result_t acp_session_rotate(acp_session_t *session,
         size_t copy_len = (new_key_len > 32) ? 32 : new_key_len;
         memcpy(session->key, new_key, copy_len);
     }
+    acp_hmac_midstate_init(&session->hmac, session->key, sizeof(session->key));
 
     session->nonce = new_nonce;
 
-    /* Reset sequence numbers */
+    /* Reset sequence numbers; the replay window size is kept */
     session->next_sequence = 1;
     session->last_accepted_seq = 0;
+    memset(session->replay_bitmap, 0, sizeof(session->replay_bitmap));
 
     return ACP_OK;
 }
@@ -127,15 +131,77 @@ void acp_session_terminate(acp_session_t *session)
 
     /* Clear sensitive key material */
     acp_crypto_clear(session->key, sizeof(session->key));
+    acp_crypto_clear(&session->hmac, sizeof(session->hmac));
 
     /* Clear session state */
     session->key_id = 0;
     session->next_sequence = 0;
     session->last_accepted_seq = 0;
+    session->replay_window = 0;
+    memset(session->replay_bitmap, 0, sizeof(session->replay_bitmap));
+    session->extended_seq = false;
+    session->concurrent_tx = false;
     session->nonce = 0;
     session->policy_flags = 0;
 }
 
+/* ========================================================================== */
+/*                           Session Accessors                               */
+/* ========================================================================== */
+
+/**
+ * @brief Get the session key identifier
+ */
+uint32_t acp_session_get_key_id(const acp_session_t *session)
+{
+    return session ? session->key_id : 0;
+}
+
+/**
+ * @brief Get the next transmit sequence number
+ */
+uint64_t acp_session_get_next_sequence(const acp_session_t *session)
+{
+    return session ? ACP_ATOMIC_LOAD_RELAXED(&session->next_sequence) : 0;
+}
+
+/**
+ * @brief Set the next transmit sequence number
+ */
+acp_result_t acp_session_set_next_sequence(acp_session_t *session, uint64_t sequence)
+{
+    if (!session || sequence == 0)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    session->next_sequence = sequence;
+    return ACP_OK;
+}
+
+/**
+ * @brief Get the highest accepted receive sequence number
+ */
+uint64_t acp_session_get_last_accepted(const acp_session_t *session)
+{
+    return session ? session->last_accepted_seq : 0;
+}
+
+/**
+ * @brief Set the highest accepted receive sequence number
+ */
+acp_result_t acp_session_set_last_accepted(acp_session_t *session, uint64_t sequence)
+{
+    if (!session)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    /* Re-applying the window size restarts it from the new top */
+    session->last_accepted_seq = sequence;
+    return acp_session_set_replay_window(session, session->replay_window);
+}
+
 /**
  * @brief Check if session is expired (simplified)
  * @param session Session context
@@ -179,7 +245,7 @@ acp_result_t acp_session_compute_hmac(const acp_session_t *session,
     }
 
     /* Compute HMAC-SHA256 truncated to 16 bytes */
-    acp_hmac_sha256(session->key, 32, frame_data, frame_len, hmac_out);
+    acp_hmac_sha256_midstate(&session->hmac, frame_data, frame_len, hmac_out);
 
     return ACP_OK;
 }
@@ -249,15 +315,15 @@ acp_result_t acp_session_get_tx_seq(acp_session_t *session, uint32_t *seq_out)
         return ACP_ERR_SESSION_NOT_INIT;
     }
 
-    *seq_out = session->next_sequence;
-    session->next_sequence++;
-
-    /* Check for sequence number rollover */
-    if (session->next_sequence == 0)
+    /* Wrapping would reuse sequence numbers the peer has already accepted */
+    if (!session->extended_seq && session->next_sequence > UINT32_MAX)
     {
-        session->next_sequence = 1; /* Skip 0 */
+        return ACP_ERR_SESSION_EXPIRED;
     }
 
+    *seq_out = (uint32_t)session->next_sequence;
+    session->next_sequence++;
+
     return ACP_OK;
 }
 
@@ -282,16 +348,247 @@ acp_result_t acp_session_check_rx_seq(acp_session_t *session, uint32_t rx_seq)
         return ACP_ERR_INVALID_PARAM;
     }
 
-    /* Simple forward progression check */
-    if (rx_seq <= session->last_accepted_seq)
+    return acp_session_accept_sequence(session, rx_seq);
+}
+
+/* ========================================================================== */
+/*                            Replay Window                                  */
+/* ========================================================================== */
+
+/*
+ * The window is a ring of 64-bit words, one bit per sequence number, with
+ * one word more than the window needs. Sliding forward never shifts bits:
+ * it just zeroes the words the highest sequence number moves into, so the
+ * cost is bounded by the window size however far it jumps.
+ */
+
+/**
+ * @brief Bitmap words in use for the session's window
+ */
+static size_t replay_words(const acp_session_t *session)
+{
+    return (size_t)session->replay_window / 64 + 1;
+}
+
+/**
+ * @brief Bitmap word holding @p sequence
+ */
+static uint64_t *replay_word(acp_session_t *session, uint64_t sequence)
+{
+    return &session->replay_bitmap[(sequence >> 6) % replay_words(session)];
+}
+
+/**
+ * @brief Configure the replay window
+ */
+acp_result_t acp_session_set_replay_window(acp_session_t *session, uint16_t bits)
+{
+    if (!session)
     {
-        return ACP_ERR_REPLAY; /* Replay or out-of-order */
+        return ACP_ERR_INVALID_PARAM;
+    }
+    if (bits != 0 && (bits < ACP_REPLAY_WINDOW_MIN || bits > ACP_REPLAY_WINDOW_MAX || bits % 64 != 0))
+    {
+        return ACP_ERR_INVALID_PARAM;
     }
 
-    session->last_accepted_seq = rx_seq;
+    session->replay_window = bits;
+    memset(session->replay_bitmap, 0, sizeof(session->replay_bitmap));
+    if (bits != 0 && session->last_accepted_seq != 0)
+    {
+        /* The highest accepted sequence number stays accepted */
+        *replay_word(session, session->last_accepted_seq) |= (uint64_t)1 << (session->last_accepted_seq & 63);
+    }
     return ACP_OK;
 }
 
+/**
+ * @brief Check a received sequence number against the replay window
+ */
+acp_result_t acp_session_accept_sequence(acp_session_t *session, uint64_t sequence)
+{
+    if (!session)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    /* Sequence 0 is never sent authenticated */
+    uint64_t top = session->last_accepted_seq;
+    if (sequence == 0)
+    {
+        return ACP_ERR_REPLAY;
+    }
+
+    if (session->replay_window == 0)
+    {
+        /* Strict forward progression */
+        if (sequence <= top)
+        {
+            return ACP_ERR_REPLAY;
+        }
+        session->last_accepted_seq = sequence;
+        return ACP_OK;
+    }
+
+    if (sequence > top)
+    {
+        /* Slide forward, clearing the words the window moves into */
+        size_t words = replay_words(session);
+        uint64_t shift = (sequence >> 6) - (top >> 6);
+        if (shift >= words)
+        {
+            memset(session->replay_bitmap, 0, words * sizeof(session->replay_bitmap[0]));
+        }
+        else
+        {
+            for (uint64_t i = 1; i <= shift; i++)
+            {
+                session->replay_bitmap[((top >> 6) + i) % words] = 0;
+            }
+        }
+        session->last_accepted_seq = sequence;
+    }
+    else if (top - sequence >= session->replay_window)
+    {
+        return ACP_ERR_REPLAY; /* Too old to tell apart from a replay */
+    }
+
+    uint64_t *word = replay_word(session, sequence);
+    uint64_t bit = (uint64_t)1 << (sequence & 63);
+    if (*word & bit)
+    {
+        return ACP_ERR_REPLAY;
+    }
+    *word |= bit;
+    return ACP_OK;
+}
+
+/* ========================================================================== */
+/*                         Concurrent Transmit                               */
+/* ========================================================================== */
+
+/**
+ * @brief Enable or disable atomic sequence allocation
+ */
+acp_result_t acp_session_set_concurrent_tx(acp_session_t *session, bool enable)
+{
+    if (!session)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    session->concurrent_tx = enable;
+    return ACP_OK;
+}
+
+/**
+ * @brief Reserve consecutive sequence numbers with one atomic add
+ */
+acp_result_t acp_session_reserve_sequences(acp_session_t *session, uint32_t count, uint64_t *first)
+{
+    if (!session || !first || count == 0)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    /* Each number only needs handing out once, not ordering against other memory */
+    uint64_t start = ACP_ATOMIC_FETCH_ADD_RELAXED(&session->next_sequence, (uint64_t)count);
+
+    /* Once past the 32-bit space the session stays expired until rotated */
+    if (!session->extended_seq && start + count - 1 > UINT32_MAX)
+    {
+        return ACP_ERR_SESSION_EXPIRED;
+    }
+
+    *first = start;
+    return ACP_OK;
+}
+
+/**
+ * @brief Initialize an empty per-thread sequence block
+ */
+acp_result_t acp_seq_block_init(acp_seq_block_t *block, acp_session_t *session, uint32_t size)
+{
+    if (!block || !session || size == 0)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    block->session = session;
+    block->next = 0;
+    block->end = 0;
+    block->size = size;
+    return ACP_OK;
+}
+
+/**
+ * @brief Hand out the next reserved number, reserving a new block when empty
+ */
+acp_result_t acp_seq_block_take(acp_seq_block_t *block, uint64_t *sequence)
+{
+    if (!block || !sequence)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    if (block->next == block->end)
+    {
+        uint64_t first;
+        acp_result_t result = acp_session_reserve_sequences(block->session, block->size, &first);
+        if (result != ACP_OK)
+        {
+            return result;
+        }
+        block->next = first;
+        block->end = first + block->size;
+    }
+
+    *sequence = block->next++;
+    return ACP_OK;
+}
+
+/* ========================================================================== */
+/*                       Extended Sequence Numbers                           */
+/* ========================================================================== */
+
+/**
+ * @brief Enable or disable 64-bit sequence numbers
+ */
+acp_result_t acp_session_set_extended_sequence(acp_session_t *session, bool enable)
+{
+    if (!session)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    session->extended_seq = enable;
+    return ACP_OK;
+}
+
+/**
+ * @brief Infer the high 32 bits of a received sequence number
+ *
+ * Serial-number arithmetic: the low bits are read as a signed 32-bit
+ * step from the highest accepted value. Unlike deriving the high bits
+ * from the replay window, this places old frames in the past, so a
+ * replay is reported as ACP_ERR_REPLAY rather than failing the HMAC.
+ */
+uint64_t acp_session_infer_sequence(const acp_session_t *session, uint32_t wire_sequence)
+{
+    if (!session || !session->extended_seq)
+    {
+        return wire_sequence;
+    }
+
+    uint64_t top = session->last_accepted_seq;
+    int32_t step = (int32_t)(wire_sequence - (uint32_t)top);
+    if (step < 0 && (uint64_t)(-(int64_t)step) > top)
+    {
+        return wire_sequence; /* Before the first epoch: only the low bits exist */
+    }
+    return top + (uint64_t)(int64_t)step;
+}
+
 /**
  * @brief Check if session is initialized
  */
@@ -0,0 +1,325 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_session_table.c
+ * @brief Open-addressing session table with optional lock striping
+ *
+ * Identifiers are mixed with a 64-bit finalizer; the high half picks the
+ * stripe and the low half the home slot within it. Lookups probe forward
+ * from the home slot until they hit the identifier or an empty slot, and
+ * each stripe always keeps an empty slot so a miss terminates. Removal
+ * moves later entries of the same probe run back into the hole, so no
+ * tombstones accumulate.
+ */
+
+#include "acp_session_table.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                              Helpers                                       */
+/* ========================================================================== */
+
+/**
+ * @brief Spread identifier bits over the whole word (SplitMix64 finalizer)
+ */
+static uint64_t table_hash(uint64_t id)
+{
+    id ^= id >> 30;
+    id *= 0xbf58476d1ce4e5b9ULL;
+    id ^= id >> 27;
+    id *= 0x94d049bb133111ebULL;
+    id ^= id >> 31;
+    return id;
+}
+
+static int is_power_of_two(size_t value)
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+/**
+ * @brief Most entries a stripe of @p slots holds: 7/8, and always one slot free
+ */
+static size_t stripe_limit(size_t slots)
+{
+    size_t reserve = slots / 8;
+    return slots - (reserve ? reserve : 1);
+}
+
+/**
+ * @brief Integer square root, rounded down
+ */
+static size_t isqrt(size_t value)
+{
+    size_t root = value;
+    size_t next = (root + 1) / 2;
+    while (next < root)
+    {
+        root = next;
+        next = (root + value / root) / 2;
+    }
+    return root;
+}
+
+static uint32_t table_stripe(const acp_session_table_t *table, uint64_t hash)
+{
+    return (uint32_t)(hash >> 32) & (table->stripes - 1);
+}
+
+static size_t table_home(const acp_session_table_t *table, uint64_t hash)
+{
+    return (size_t)hash & (table->stripe_slots - 1);
+}
+
+static int table_lock(acp_session_stripe_t *stripe)
+{
+    return stripe->lock == NULL || acp_platform_mutex_lock(stripe->lock) == 0;
+}
+
+static void table_unlock(acp_session_stripe_t *stripe)
+{
+    if (stripe->lock != NULL)
+    {
+        acp_platform_mutex_unlock(stripe->lock);
+    }
+}
+
+/**
+ * @brief Slot index of @p id within a stripe, or -1 if absent
+ */
+static ptrdiff_t table_probe(const acp_session_table_t *table, const acp_session_slot_t *slots,
+                             uint64_t hash, uint64_t id)
+{
+    size_t mask = table->stripe_slots - 1;
+    for (size_t i = table_home(table, hash);; i = (i + 1) & mask)
+    {
+        if (slots[i].session == NULL)
+        {
+            return -1;
+        }
+        if (slots[i].id == id)
+        {
+            return (ptrdiff_t)i;
+        }
+    }
+}
+
+/* ========================================================================== */
+/*                              Functions                                     */
+/* ========================================================================== */
+
+size_t acp_session_table_slots_needed(size_t sessions, uint32_t stripes)
+{
+    if (!is_power_of_two(stripes) || stripes > ACP_SESSION_TABLE_MAX_STRIPES || sessions > SIZE_MAX / 2)
+    {
+        return 0;
+    }
+
+    /*
+     * Smallest power-of-two stripe whose limit covers an even share, plus
+     * four standard deviations of headroom: the hash spreads sessions over
+     * the stripes like random keys, not in equal shares.
+     */
+    size_t per_stripe = (sessions + stripes - 1) / stripes;
+    if (stripes > 1)
+    {
+        per_stripe += 4 * isqrt(per_stripe);
+    }
+    size_t slots = 2;
+    while (stripe_limit(slots) < per_stripe)
+    {
+        if (slots > SIZE_MAX / 2 / stripes)
+        {
+            return 0;
+        }
+        slots <<= 1;
+    }
+    return slots * stripes;
+}
+
+acp_result_t acp_session_table_init(acp_session_table_t *table, acp_session_slot_t *slots,
+                                    size_t slot_count, acp_mutex_t **locks, uint32_t stripes)
+{
+    if (table == NULL || slots == NULL || !is_power_of_two(slot_count) ||
+        !is_power_of_two(stripes) || stripes > ACP_SESSION_TABLE_MAX_STRIPES ||
+        slot_count / stripes < 2)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+    for (uint32_t s = 0; locks != NULL && s < stripes; s++)
+    {
+        if (locks[s] == NULL)
+        {
+            return ACP_ERR_INVALID_PARAM;
+        }
+    }
+
+    memset(table, 0, sizeof(*table));
+    memset(slots, 0, slot_count * sizeof(slots[0]));
+    table->slots = slots;
+    table->stripes = stripes;
+    table->stripe_slots = slot_count / stripes;
+    table->stripe_limit = stripe_limit(table->stripe_slots);
+
+    for (uint32_t s = 0; locks != NULL && s < stripes; s++)
+    {
+        table->stripe[s].lock = locks[s];
+    }
+    return ACP_OK;
+}
+
+acp_result_t acp_session_table_insert(acp_session_table_t *table, uint64_t id, acp_session_t *session)
+{
+    if (table == NULL || table->slots == NULL || session == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    uint64_t hash = table_hash(id);
+    uint32_t s = table_stripe(table, hash);
+    acp_session_stripe_t *stripe = &table->stripe[s];
+    acp_session_slot_t *slots = table->slots + (size_t)s * table->stripe_slots;
+    if (!table_lock(stripe))
+    {
+        return ACP_ERR_PLATFORM_MUTEX;
+    }
+
+    acp_result_t result = ACP_OK;
+    size_t mask = table->stripe_slots - 1;
+    size_t i = table_home(table, hash);
+    for (; slots[i].session != NULL; i = (i + 1) & mask)
+    {
+        if (slots[i].id == id)
+        {
+            result = ACP_ERR_ALREADY_EXISTS;
+            break;
+        }
+    }
+    if (result == ACP_OK && stripe->count >= table->stripe_limit)
+    {
+        result = ACP_ERR_BUFFER_TOO_SMALL;
+    }
+    if (result == ACP_OK)
+    {
+        slots[i].id = id;
+        slots[i].session = session;
+        ACP_ATOMIC_STORE_RELAXED(&stripe->count, stripe->count + 1);
+    }
+
+    table_unlock(stripe);
+    return result;
+}
+
+acp_result_t acp_session_table_find(acp_session_table_t *table, uint64_t id, acp_session_t **session)
+{
+    if (table == NULL || table->slots == NULL || session == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    uint64_t hash = table_hash(id);
+    uint32_t s = table_stripe(table, hash);
+    acp_session_stripe_t *stripe = &table->stripe[s];
+    const acp_session_slot_t *slots = table->slots + (size_t)s * table->stripe_slots;
+    if (!table_lock(stripe))
+    {
+        return ACP_ERR_PLATFORM_MUTEX;
+    }
+
+    ptrdiff_t i = table_probe(table, slots, hash, id);
+    if (i >= 0)
+    {
+        *session = slots[i].session;
+    }
+
+    table_unlock(stripe);
+    return (i >= 0) ? ACP_OK : ACP_ERR_NOT_FOUND;
+}
+
+acp_result_t acp_session_table_remove(acp_session_table_t *table, uint64_t id, acp_session_t **session)
+{
+    if (table == NULL || table->slots == NULL)
+    {
+        return ACP_ERR_INVALID_PARAM;
+    }
+
+    uint64_t hash = table_hash(id);
+    uint32_t s = table_stripe(table, hash);
+    acp_session_stripe_t *stripe = &table->stripe[s];
+    acp_session_slot_t *slots = table->slots + (size_t)s * table->stripe_slots;
+    if (!table_lock(stripe))
+    {
+        return ACP_ERR_PLATFORM_MUTEX;
+    }
+
+    ptrdiff_t found = table_probe(table, slots, hash, id);
+    if (found < 0)
+    {
+        table_unlock(stripe);
+        return ACP_ERR_NOT_FOUND;
+    }
+    if (session != NULL)
+    {
+        *session = slots[found].session;
+    }
+
+    /*
+     * Backward-shift deletion: walk the rest of the probe run and move back
+     * every entry whose home slot does not lie cyclically in (hole, j], as
+     * the hole would otherwise cut it off from its home.
+     */
+    size_t mask = table->stripe_slots - 1;
+    size_t hole = (size_t)found;
+    for (size_t j = (hole + 1) & mask; slots[j].session != NULL; j = (j + 1) & mask)
+    {
+        size_t home = table_home(table, table_hash(slots[j].id));
+        int reachable = (hole <= j) ? (hole < home && home <= j) : (hole < home || home <= j);
+        if (!reachable)
+        {
+            slots[hole] = slots[j];
+            hole = j;
+        }
+    }
+    slots[hole].id = 0;
+    slots[hole].session = NULL;
+    ACP_ATOMIC_STORE_RELAXED(&stripe->count, stripe->count - 1);
+
+    table_unlock(stripe);
+    return ACP_OK;
+}
+
+size_t acp_session_table_count(const acp_session_table_t *table)
+{
+    if (table == NULL)
+    {
+        return 0;
+    }
+
+    /* Counts change under their stripe's lock; read them without it */
+    size_t total = 0;
+    for (uint32_t s = 0; s < table->stripes; s++)
+    {
+        total += ACP_ATOMIC_LOAD_RELAXED(&table->stripe[s].count);
+    }
+    return total;
+}
@@ -0,0 +1,188 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file acp_session_table.h
+ * @brief Hash table mapping peer or key identifiers to sessions
+ *
+ * Lets a gateway terminating many devices find the session for an incoming
+ * frame in constant time, however many peers it serves. The table is open
+ * addressing with linear probing over caller-provided slots, so it never
+ * allocates; removal shifts later entries back instead of leaving
+ * tombstones, so probe lengths stay short under churn.
+ *
+ * The slots can be split into independently locked stripes: each
+ * identifier hashes to one stripe and is probed only within it, so threads
+ * working on different peers rarely wait for each other. Without locks the
+ * table must be used from one thread at a time.
+ *
+ * The table stores pointers; the sessions themselves stay wherever the
+ * caller keeps them and must outlive their entries.
+ *
+ * @version 0.3.0
+ * @date 2025-10-27
+ */
+
+#ifndef ACP_SESSION_TABLE_H
+#define ACP_SESSION_TABLE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "acp_config.h"
+#include "acp_protocol.h"
+#include "acp_platform_mutex.h"
+
+/** @brief Most lock stripes a table can be split into */
+#define ACP_SESSION_TABLE_MAX_STRIPES 64
+
+    /* ========================================================================== */
+    /*                              Types                                         */
+    /* ========================================================================== */
+
+    /**
+     * @brief One table slot; empty when @c session is NULL
+     */
+    typedef struct
+    {
+        uint64_t id;            /**< Key or peer identifier */
+        acp_session_t *session; /**< Session for @c id */
+    } acp_session_slot_t;
+
+    /**
+     * @brief Lock and occupancy for one stripe, on its own cache line
+     */
+    typedef struct
+    {
+        ACP_CACHE_ALIGNED acp_mutex_t *lock; /**< Stripe lock (NULL: unlocked table) */
+        size_t count;                        /**< Entries in the stripe (written under the lock) */
+    } acp_session_stripe_t;
+
+    /**
+     * @brief Session table over caller-provided slots
+     */
+    typedef struct
+    {
+        acp_session_slot_t *slots; /**< Slot storage, stripe after stripe */
+        size_t stripe_slots;       /**< Slots per stripe, a power of two */
+        size_t stripe_limit;       /**< Most entries per stripe, leaving probes short */
+        uint32_t stripes;          /**< Number of stripes, a power of two */
+        acp_session_stripe_t stripe[ACP_SESSION_TABLE_MAX_STRIPES]; /**< Per-stripe state */
+    } acp_session_table_t;
+
+    /* ========================================================================== */
+    /*                              Functions                                     */
+    /* ========================================================================== */
+
+    /**
+     * @brief Number of slots needed to hold a given number of sessions
+     *
+     * Rounds up to a power of two per stripe with room for the load limit,
+     * for sizing static storage or a single allocation at startup. With
+     * several stripes, each also gets headroom for the uneven spread of
+     * hashed identifiers; identifiers chosen to collide can still fill one
+     * stripe early.
+     *
+     * @param sessions Number of sessions the table must hold
+     * @param stripes Number of stripes (a power of two)
+     * @return Slots to pass to acp_session_table_init(), or 0 if out of range
+     */
+    size_t acp_session_table_slots_needed(size_t sessions, uint32_t stripes);
+
+    /**
+     * @brief Initialize an empty table over caller-provided slots
+     *
+     * Each stripe holds up to 7/8 of its slots. With @p locks, every
+     * operation takes the lock of the stripe its identifier hashes to;
+     * the locks must be distinct and outlive the table.
+     *
+     * @param table Table to initialize
+     * @param slots Slot storage
+     * @param slot_count Number of slots (a power of two, at least 2 per stripe)
+     * @param locks One mutex per stripe, or NULL for an unlocked table
+     * @param stripes Number of stripes (a power of two, at most
+     *                ACP_SESSION_TABLE_MAX_STRIPES)
+     * @return ACP_OK on success, ACP_ERR_INVALID_PARAM on bad arguments
+     */
+    acp_result_t acp_session_table_init(acp_session_table_t *table, acp_session_slot_t *slots,
+                                        size_t slot_count, acp_mutex_t **locks, uint32_t stripes);
+
+    /**
+     * @brief Add a session under an identifier
+     *
+     * @param table Table
+     * @param id Key or peer identifier
+     * @param session Session to store (not copied)
+     * @return ACP_OK on success, ACP_ERR_ALREADY_EXISTS if @p id is present,
+     *         ACP_ERR_BUFFER_TOO_SMALL if its stripe is full,
+     *         ACP_ERR_INVALID_PARAM on bad arguments,
+     *         ACP_ERR_PLATFORM_MUTEX if the stripe lock fails
+     */
+    acp_result_t acp_session_table_insert(acp_session_table_t *table, uint64_t id, acp_session_t *session);
+
+    /**
+     * @brief Find the session stored under an identifier
+     *
+     * @param table Table
+     * @param id Key or peer identifier
+     * @param session Returns the session
+     * @return ACP_OK if found, ACP_ERR_NOT_FOUND if not,
+     *         ACP_ERR_INVALID_PARAM on bad arguments,
+     *         ACP_ERR_PLATFORM_MUTEX if the stripe lock fails
+     */
+    acp_result_t acp_session_table_find(acp_session_table_t *table, uint64_t id, acp_session_t **session);
+
+    /**
+     * @brief Remove the entry for an identifier
+     *
+     * The session itself is untouched; terminate it separately once no
+     * other thread can still be using it.
+     *
+     * @param table Table
+     * @param id Key or peer identifier
+     * @param session Returns the removed session (may be NULL)
+     * @return ACP_OK if removed, ACP_ERR_NOT_FOUND if not present,
+     *         ACP_ERR_INVALID_PARAM on bad arguments,
+     *         ACP_ERR_PLATFORM_MUTEX if the stripe lock fails
+     */
+    acp_result_t acp_session_table_remove(acp_session_table_t *table, uint64_t id, acp_session_t **session);
+
+    /**
+     * @brief Number of entries in the table
+     *
+     * Takes no locks: while other threads insert or remove, the result is a
+     * sum of per-stripe snapshots rather than one instant's total.
+     *
+     * @param table Table
+     * @return Entries across all stripes
+     */
+    size_t acp_session_table_count(const acp_session_table_t *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACP_SESSION_TABLE_H */
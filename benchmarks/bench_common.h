@@ -0,0 +1,74 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file bench_common.h
+ * @brief Timing helpers shared by the ACP benchmark programs
+ *
+ * Benchmarks are POSIX programs; wall time comes from CLOCK_MONOTONIC and,
+ * on x86, the time-stamp counter is sampled to report cycles per byte.
+ */
+
+#ifndef ACP_BENCH_COMMON_H
+#define ACP_BENCH_COMMON_H
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define ACP_BENCH_HAVE_TSC 1
+#endif
+
+/**
+ * @brief Monotonic wall-clock time in nanoseconds
+ */
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Time-stamp counter (0 where unavailable)
+ */
+static inline uint64_t bench_cycles(void)
+{
+#ifdef ACP_BENCH_HAVE_TSC
+    return (uint64_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Keep a computed value alive so the optimiser cannot drop the work
+ */
+static volatile uint32_t bench_sink;
+
+static inline void bench_consume(uint32_t value)
+{
+    bench_sink ^= value;
+}
+
+#endif /* ACP_BENCH_COMMON_H */
@@ -0,0 +1,105 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file bench_crc16.c
+ * @brief CRC16 kernel benchmark
+ *
+ * Reports GB/s for each acp_crc16_update() kernel available on the running
+ * CPU, over buffers sized like a short frame, a full frame and a block of
+ * captured traffic.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "acp_crc16.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <string.h>
+
+/** @brief Target amount of data checksummed per measurement */
+#define BENCH_TOTAL_BYTES (256u * 1024u * 1024u)
+
+/** @brief Largest buffer checksummed */
+#define BENCH_MAX_LEN (256u * 1024u)
+
+static uint8_t crc_buffer[BENCH_MAX_LEN];
+
+static double run_kernel(size_t len)
+{
+    size_t iterations = BENCH_TOTAL_BYTES / len;
+    uint16_t crc = ACP_CRC16_INIT;
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        crc = acp_crc16_update(crc, crc_buffer, len);
+    }
+
+    uint64_t start_ns = bench_now_ns();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        crc = acp_crc16_update(crc, crc_buffer, len);
+    }
+    uint64_t ns = bench_now_ns() - start_ns;
+    bench_consume(crc);
+
+    return ((double)iterations * (double)len) / (double)ns; /* bytes/ns == GB/s */
+}
+
+int main(void)
+{
+    static const size_t lengths[] = {64, 1024, 16 * 1024, BENCH_MAX_LEN};
+
+    printf("ACP CRC16 kernel benchmark (GB/s)\n");
+    printf("=================================\n");
+
+    for (size_t i = 0; i < BENCH_MAX_LEN; i++)
+    {
+        crc_buffer[i] = (uint8_t)(i * 131u + 7u);
+    }
+
+    printf("%-8s", "kernel");
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        printf("  %9zuB", lengths[l]);
+    }
+    printf("\n");
+
+    for (int k = ACP_CRC16_KERNEL_TABLE; k < ACP_CRC16_KERNEL_COUNT; k++)
+    {
+        if (acp_crc16_set_kernel((acp_crc16_kernel_t)k) != 0)
+        {
+            continue;
+        }
+
+        printf("%-8s", acp_crc16_kernel_name((acp_crc16_kernel_t)k));
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            printf("  %10.2f", run_kernel(lengths[l]));
+        }
+        printf("\n");
+    }
+
+    acp_crc16_set_kernel(ACP_CRC16_KERNEL_AUTO);
+    printf("\nauto-selected: %s\n", acp_crc16_kernel_name(acp_crc16_get_kernel()));
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file bench_scan.c
+ * @brief Zero-scan kernel benchmark
+ *
+ * Reports GB/s for each acp_scan_zero() kernel available on the running
+ * CPU, with the C library memchr() as a reference, over zero-free buffers
+ * sized like a short frame, a full frame and a block of captured traffic.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "acp_scan.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <string.h>
+
+/** @brief Target amount of data scanned per measurement */
+#define BENCH_TOTAL_BYTES (512u * 1024u * 1024u)
+
+/** @brief Largest buffer scanned */
+#define BENCH_MAX_LEN (256u * 1024u)
+
+static uint8_t scan_buffer[BENCH_MAX_LEN + 1];
+
+static double run_kernel(int use_memchr, size_t len)
+{
+    size_t iterations = BENCH_TOTAL_BYTES / len;
+    size_t sum = 0;
+
+    /* Zero sits just past the scanned range, so every byte is examined */
+    for (size_t i = 0; i < 1000; i++)
+    {
+        sum += acp_scan_zero(scan_buffer, len);
+    }
+
+    uint64_t start_ns = bench_now_ns();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        if (use_memchr)
+        {
+            const uint8_t *p = (const uint8_t *)memchr(scan_buffer, 0, len);
+            sum += p ? (size_t)(p - scan_buffer) : len;
+        }
+        else
+        {
+            sum += acp_scan_zero(scan_buffer, len);
+        }
+    }
+    uint64_t ns = bench_now_ns() - start_ns;
+    bench_consume((uint32_t)sum);
+
+    return ((double)iterations * (double)len) / (double)ns; /* bytes/ns == GB/s */
+}
+
+int main(void)
+{
+    static const size_t lengths[] = {64, 1024, 16 * 1024, BENCH_MAX_LEN};
+
+    printf("ACP zero-scan kernel benchmark (GB/s)\n");
+    printf("=====================================\n");
+
+    memset(scan_buffer, 0x5A, BENCH_MAX_LEN);
+    scan_buffer[BENCH_MAX_LEN] = 0;
+
+    printf("%-8s", "kernel");
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        printf("  %9zuB", lengths[l]);
+    }
+    printf("\n");
+
+    for (int k = ACP_SCAN_KERNEL_SCALAR; k <= ACP_SCAN_KERNEL_COUNT; k++)
+    {
+        int use_memchr = (k == ACP_SCAN_KERNEL_COUNT);
+        if (!use_memchr && acp_scan_set_kernel((acp_scan_kernel_t)k) != 0)
+        {
+            continue;
+        }
+
+        printf("%-8s", use_memchr ? "memchr" : acp_scan_kernel_name((acp_scan_kernel_t)k));
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            printf("  %10.2f", run_kernel(use_memchr, lengths[l]));
+        }
+        printf("\n");
+    }
+
+    acp_scan_set_kernel(ACP_SCAN_KERNEL_AUTO);
+    printf("\nauto-selected: %s\n", acp_scan_kernel_name(acp_scan_get_kernel()));
+    return 0;
+}
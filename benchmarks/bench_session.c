@@ -0,0 +1,259 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file bench_session.c
+ * @brief Cost of a sender and a receiver sharing one session
+ *
+ * First runs the sequence counter updates alone: one thread bumps the
+ * transmit counter while another advances the receive counter, once in a
+ * copy of the old packed session layout, where both counters share a cache
+ * line, and once in acp_session_t itself. Then a sender thread encodes
+ * authenticated frames in concurrent transmit mode while a receiver thread
+ * decodes a pre-encoded stream, both on the same session, and compares the
+ * rates with each side running alone.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "acp_protocol.h"
+#include "acp_errors.h"
+#include "bench_common.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define COUNTER_OPS 20000000u
+#define BENCH_FRAMES 200000u
+#define BENCH_PAYLOAD 64
+#define BENCH_FRAME_SLOT (BENCH_PAYLOAD + 48)
+
+static const uint8_t bench_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+/** @brief Field order of acp_session_t before the sections were split */
+typedef struct
+{
+    uint32_t key_id;
+    uint8_t key[32];
+    acp_hmac_midstate_t hmac;
+    uint64_t nonce;
+    uint64_t next_sequence;
+    uint64_t last_accepted_seq;
+} packed_session_t;
+
+static ACP_CACHE_ALIGNED packed_session_t packed;
+static acp_session_t session;
+
+static uint8_t stream[BENCH_FRAMES][BENCH_FRAME_SLOT];
+static size_t stream_lens[BENCH_FRAMES];
+
+static int start_flag;
+
+/** @brief One side of a two-thread run */
+typedef struct
+{
+    void *(*body)(void *);
+    uint64_t *counter;
+    uint64_t ns;
+} side_t;
+
+static void wait_for_start(void)
+{
+    while (!__atomic_load_n(&start_flag, __ATOMIC_ACQUIRE))
+    {
+    }
+}
+
+/* Transmit counter: relaxed fetch-add, as acp_session_reserve_sequences() */
+static void *tx_counter_body(void *arg)
+{
+    side_t *side = (side_t *)arg;
+    wait_for_start();
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < COUNTER_OPS; i++)
+    {
+        __atomic_fetch_add(side->counter, 1, __ATOMIC_RELAXED);
+    }
+    side->ns = bench_now_ns() - start;
+    return NULL;
+}
+
+/* Receive counter: check and advance, as strict acp_session_accept_sequence() */
+static void *rx_counter_body(void *arg)
+{
+    side_t *side = (side_t *)arg;
+    wait_for_start();
+    uint64_t start = bench_now_ns();
+    for (uint64_t seq = 1; seq <= COUNTER_OPS; seq++)
+    {
+        if (seq > __atomic_load_n(side->counter, __ATOMIC_RELAXED))
+        {
+            __atomic_store_n(side->counter, seq, __ATOMIC_RELAXED);
+        }
+    }
+    side->ns = bench_now_ns() - start;
+    return NULL;
+}
+
+/* Sender: encode authenticated frames on the shared session */
+static void *tx_frame_body(void *arg)
+{
+    side_t *side = (side_t *)arg;
+    uint8_t payload[BENCH_PAYLOAD];
+    uint8_t output[BENCH_FRAME_SLOT];
+    memset(payload, 0x3c, sizeof(payload));
+    wait_for_start();
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_FRAMES; i++)
+    {
+        size_t len = sizeof(output);
+        if (acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                             &session, output, &len) == ACP_OK)
+        {
+            bench_consume(output[len - 1]);
+        }
+    }
+    side->ns = bench_now_ns() - start;
+    return NULL;
+}
+
+/* Receiver: decode and verify the pre-encoded stream on the shared session */
+static void *rx_frame_body(void *arg)
+{
+    side_t *side = (side_t *)arg;
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+    wait_for_start();
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_FRAMES; i++)
+    {
+        acp_frame_view_t view;
+        size_t consumed;
+        if (acp_decode_frame_view(stream[i], stream_lens[i], decode_buf, sizeof(decode_buf),
+                                  &view, &consumed, &session) == ACP_OK)
+        {
+            bench_consume(view.sequence);
+        }
+    }
+    side->ns = bench_now_ns() - start;
+    return NULL;
+}
+
+/**
+ * @brief Run up to two sides at once and record each side's time
+ */
+static void run_sides(side_t *a, side_t *b)
+{
+    pthread_t ta;
+    pthread_t tb;
+    __atomic_store_n(&start_flag, 0, __ATOMIC_RELAXED);
+    pthread_create(&ta, NULL, a->body, a);
+    if (b)
+    {
+        pthread_create(&tb, NULL, b->body, b);
+    }
+    __atomic_store_n(&start_flag, 1, __ATOMIC_RELEASE);
+    pthread_join(ta, NULL);
+    if (b)
+    {
+        pthread_join(tb, NULL);
+    }
+}
+
+static void counter_case(const char *name, uint64_t *tx, uint64_t *rx)
+{
+    side_t tx_side = {tx_counter_body, tx, 0};
+    side_t rx_side = {rx_counter_body, rx, 0};
+
+    *tx = 1;
+    *rx = 0;
+    run_sides(&tx_side, &rx_side);
+    printf("  %-22s tx %5.2f ns/op  rx %5.2f ns/op  (counters %zu bytes apart)\n",
+           name, (double)tx_side.ns / COUNTER_OPS, (double)rx_side.ns / COUNTER_OPS,
+           (size_t)((uint8_t *)rx - (uint8_t *)tx));
+}
+
+/**
+ * @brief Reset the shared session for a frame run
+ */
+static void reset_session(void)
+{
+    acp_session_init(&session, 1, bench_key, sizeof(bench_key), 0x1234);
+    acp_session_set_concurrent_tx(&session, true);
+}
+
+int main(void)
+{
+    printf("ACP session sharing benchmark\n");
+    printf("=============================\n");
+
+    acp_init();
+
+    if (sysconf(_SC_NPROCESSORS_ONLN) < 2)
+    {
+        printf("Only one CPU online: the threads will take turns rather than contend\n");
+    }
+
+    printf("\nCounter updates, %u per thread, both threads at once:\n", COUNTER_OPS);
+    counter_case("packed layout", &packed.next_sequence, &packed.last_accepted_seq);
+    counter_case("acp_session_t layout", &session.next_sequence, &session.last_accepted_seq);
+
+    /* Receive stream from a separate sender with the same key */
+    acp_session_t stream_session;
+    acp_session_init(&stream_session, 1, bench_key, sizeof(bench_key), 0x1234);
+    uint8_t payload[BENCH_PAYLOAD];
+    memset(payload, 0x5a, sizeof(payload));
+    for (uint32_t i = 0; i < BENCH_FRAMES; i++)
+    {
+        stream_lens[i] = BENCH_FRAME_SLOT;
+        if (acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                             &stream_session, stream[i], &stream_lens[i]) != ACP_OK)
+        {
+            printf("encode failed\n");
+            return 1;
+        }
+    }
+
+    side_t tx_side = {tx_frame_body, NULL, 0};
+    side_t rx_side = {rx_frame_body, NULL, 0};
+
+    printf("\n%u authenticated %d-byte frames on one session:\n", BENCH_FRAMES, BENCH_PAYLOAD);
+    reset_session();
+    run_sides(&tx_side, NULL);
+    double tx_alone = (double)tx_side.ns / BENCH_FRAMES;
+    reset_session();
+    run_sides(&rx_side, NULL);
+    double rx_alone = (double)rx_side.ns / BENCH_FRAMES;
+    reset_session();
+    run_sides(&tx_side, &rx_side);
+    printf("  encode %6.1f ns/frame alone, %6.1f ns/frame with a concurrent receiver\n",
+           tx_alone, (double)tx_side.ns / BENCH_FRAMES);
+    printf("  decode %6.1f ns/frame alone, %6.1f ns/frame with a concurrent sender\n",
+           rx_alone, (double)rx_side.ns / BENCH_FRAMES);
+
+    acp_cleanup();
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Autonomous Command Protocol (ACP)
+ * Reference C Implementation
+ *
+ * Copyright (c) 2025 Northbound Networks
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ * OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file bench_session_table.c
+ * @brief Session lookup cost as the number of peers grows
+ *
+ * Fills an acp_session_table_t with sequential peer identifiers and times
+ * random lookups at each size, next to a linear scan of an identifier list
+ * as a gateway without the table would do. The table's cost should stay
+ * flat while the scan grows with the peer count.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "acp_protocol.h"
+#include "acp_session_table.h"
+#include "bench_common.h"
+#include <stdio.h>
+
+#define MAX_PEERS 500000
+#define MAX_SLOTS 1048576
+#define TABLE_LOOKUPS 2000000u
+#define SCAN_LOOKUPS 2000u
+#define POOL_SIZE 64
+
+static acp_session_slot_t slots[MAX_SLOTS];
+static uint64_t peer_list[MAX_PEERS];
+static acp_session_t pool[POOL_SIZE];
+
+static uint32_t rng_state = 2463534242u;
+static uint32_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void run_size(size_t peers)
+{
+    acp_session_table_t table;
+    size_t slot_count = acp_session_table_slots_needed(peers, 1);
+    if (slot_count == 0 || slot_count > MAX_SLOTS ||
+        acp_session_table_init(&table, slots, slot_count, NULL, 1) != ACP_OK)
+    {
+        printf("  %7zu peers: table does not fit\n", peers);
+        return;
+    }
+    for (size_t i = 0; i < peers; i++)
+    {
+        peer_list[i] = i + 1;
+        acp_session_table_insert(&table, i + 1, &pool[i % POOL_SIZE]);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t n = 0; n < TABLE_LOOKUPS; n++)
+    {
+        acp_session_t *session = NULL;
+        if (acp_session_table_find(&table, next_random() % peers + 1, &session) == ACP_OK)
+        {
+            bench_consume((uint32_t)(session - pool));
+        }
+    }
+    double table_ns = (double)(bench_now_ns() - start) / TABLE_LOOKUPS;
+
+    start = bench_now_ns();
+    for (uint32_t n = 0; n < SCAN_LOOKUPS; n++)
+    {
+        uint64_t id = next_random() % peers + 1;
+        for (size_t i = 0; i < peers; i++)
+        {
+            if (peer_list[i] == id)
+            {
+                bench_consume((uint32_t)i);
+                break;
+            }
+        }
+    }
+    double scan_ns = (double)(bench_now_ns() - start) / SCAN_LOOKUPS;
+
+    printf("  %7zu peers  %8zu slots  table %6.1f ns/lookup  linear scan %10.1f ns/lookup\n",
+           peers, slot_count, table_ns, scan_ns);
+}
+
+int main(void)
+{
+    static const size_t sizes[] = {100, 1000, 10000, 100000, MAX_PEERS};
+
+    printf("ACP session table lookup benchmark\n");
+    printf("==================================\n");
+    printf("Random lookups of present peers, one unlocked stripe:\n");
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        run_size(sizes[i]);
+    }
+    return 0;
+}
@@ -29,15 +29,20 @@
  * 2. COBS framing boundary detection
  * 3. Multiple frame handling in a continuous stream
  * 4. Error handling for malformed frames
+ * 5. Pipelined receive: a reader thread fills a lock-free ring while the
+ *    main thread parses from it
  */
 
 #include "acp_protocol.h"
 #include "acp_errors.h"
+#include "acp_ring.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
 
 /**
  * @brief Mock serial port state
@@ -146,12 +151,12 @@ static int send_sample_frames(mock_serial_t *serial)
         return -1;
     }
 
-    // Encode second frame (command)
+    // Encode second frame (system status; commands would need a session)
     uint8_t frame2_buffer[128];
     size_t frame2_len = sizeof(frame2_buffer);
 
     result = acp_encode_frame(
-        ACP_FRAME_TYPE_COMMAND,
+        ACP_FRAME_TYPE_SYSTEM,
         0, // No authentication for this test
         command_payload,
         sizeof(command_payload),
@@ -193,6 +198,34 @@ static int send_sample_frames(mock_serial_t *serial)
     return 0;
 }
 
+/**
+ * @brief Parser frame handler: print the frame and count it
+ */
+static void on_frame(void *context, const acp_frame_view_t *view)
+{
+    int *frame_count = (int *)context;
+    (*frame_count)++;
+
+    printf("\n✓ Frame %d decoded:\n", *frame_count);
+    printf("  Type: %u, Flags: 0x%02x, Length: %u\n",
+           view->type, view->flags, view->length);
+    printf("  Payload: ");
+    for (size_t i = 0; i < view->length; i++)
+    {
+        printf("%02x ", view->payload[i]);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief Parser error handler: report the rejected frame
+ */
+static void on_error(void *context, acp_result_t error, uint64_t offset)
+{
+    (void)context;
+    printf("✗ Frame decode error %d, stream offset %llu\n", error, (unsigned long long)offset);
+}
+
 /**
  * @brief Receive and decode frames from mock serial
  */
@@ -200,107 +233,25 @@ static int receive_frames(mock_serial_t *serial)
 {
     printf("\nReceiving frames...\n");
 
-    uint8_t receive_buffer[512];
-    size_t buffer_pos = 0;
+    // The parser owns the partial-frame buffer and resync; we only push reads
+    static acp_parser_t parser;
     int frame_count = 0;
+    acp_parser_init(&parser, NULL, on_frame, on_error, &frame_count); // No authentication for this test
 
-    // Stream processing loop
+    uint8_t read_buffer[64];
     while (mock_serial_available(serial) > 0)
     {
-        // Read more data from serial port
-        size_t available_space = sizeof(receive_buffer) - buffer_pos;
-        if (available_space == 0)
-        {
-            printf("Receive buffer full, resetting\n");
-            buffer_pos = 0;
-            available_space = sizeof(receive_buffer);
-        }
-
-        size_t bytes_read = mock_serial_read(serial,
-                                             &receive_buffer[buffer_pos],
-                                             available_space);
-
+        size_t bytes_read = mock_serial_read(serial, read_buffer, sizeof(read_buffer));
         if (bytes_read == 0)
         {
             break; // No more data
         }
 
-        buffer_pos += bytes_read;
-
-        printf("Read %zu bytes, buffer now has %zu bytes\n", bytes_read, buffer_pos);
-
-        // Try to decode frames from current buffer
-        size_t processed = 0;
-
-        while (processed < buffer_pos)
-        {
-            acp_frame_t frame;
-            size_t consumed = 0;
-
-            acp_result_t result = acp_decode_frame(
-                &receive_buffer[processed],
-                buffer_pos - processed,
-                &frame,
-                &consumed,
-                NULL // No authentication for this test
-            );
-
-            if (result == ACP_OK)
-            {
-                // Successfully decoded a frame
-                frame_count++;
-                printf("\n✓ Frame %d decoded (%zu bytes consumed):\n",
-                       frame_count, consumed);
-                printf("  Type: %u, Flags: 0x%02x, Length: %u\n",
-                       frame.type, frame.flags, frame.length);
-                printf("  Payload: ");
-                for (size_t i = 0; i < frame.length; i++)
-                {
-                    printf("%02x ", frame.payload[i]);
-                }
-                printf("\n");
-
-                processed += consumed;
-            }
-            else if (result == ACP_ERR_NEED_MORE_DATA)
-            {
-                // Need more data to complete frame
-                printf("Need more data (have %zu bytes)\n", buffer_pos - processed);
-                break;
-            }
-            else
-            {
-                // Frame decode error - skip one byte and try again
-                printf("✗ Frame decode error %d, skipping byte 0x%02x\n",
-                       result, receive_buffer[processed]);
-                processed++;
-            }
-        }
-
-        // Move remaining data to start of buffer
-        if (processed > 0 && processed < buffer_pos)
-        {
-            memmove(receive_buffer, &receive_buffer[processed], buffer_pos - processed);
-            buffer_pos -= processed;
-        }
-        else if (processed >= buffer_pos)
-        {
-            buffer_pos = 0;
-        }
+        printf("Read %zu bytes\n", bytes_read);
+        acp_parser_push(&parser, read_buffer, bytes_read);
     }
 
     printf("\nTotal frames received: %d\n", frame_count);
-
-    if (buffer_pos > 0)
-    {
-        printf("Remaining buffer data (%zu bytes): ", buffer_pos);
-        for (size_t i = 0; i < buffer_pos && i < 16; i++)
-        {
-            printf("%02x ", receive_buffer[i]);
-        }
-        printf("\n");
-    }
-
     return frame_count;
 }
 
@@ -333,6 +284,11 @@ static int test_partial_reads(mock_serial_t *serial)
 
     printf("Sending test frame in chunks...\n");
 
+    // The decoder keeps partial frame state, so each chunk is fed exactly once
+    static uint8_t decoder_buffer[ACP_DECODER_BUFFER_SIZE];
+    acp_decoder_t decoder;
+    acp_decoder_init(&decoder, decoder_buffer, sizeof(decoder_buffer));
+
     // Send frame in small chunks to test partial read handling
     for (size_t i = 0; i < frame_len; i += 3)
     {
@@ -340,31 +296,22 @@ static int test_partial_reads(mock_serial_t *serial)
         mock_serial_write(serial, &frame_buffer[i], chunk_size);
         printf("Sent chunk %zu: %zu bytes\n", i / 3 + 1, chunk_size);
 
-        // Try to decode with each partial chunk
-        uint8_t read_buffer[128];
-        size_t total_read = 0;
-
-        while (mock_serial_available(serial) > 0 && total_read < sizeof(read_buffer))
-        {
-            size_t read_this_time = mock_serial_read(serial,
-                                                     &read_buffer[total_read], 1);
-            total_read += read_this_time;
-        }
+        uint8_t read_buffer[16];
+        size_t bytes_read = mock_serial_read(serial, read_buffer, sizeof(read_buffer));
 
-        acp_frame_t frame;
+        acp_frame_view_t view;
         size_t consumed = 0;
-        result = acp_decode_frame(read_buffer, total_read, &frame, &consumed, NULL);
+        result = acp_decoder_decode(&decoder, read_buffer, bytes_read, &consumed, &view, NULL);
 
         if (result == ACP_OK)
         {
-            printf("✓ Complete frame decoded on chunk %zu\n", i / 3 + 1);
+            printf("✓ Complete frame decoded on chunk %zu (%u byte payload)\n",
+                   i / 3 + 1, view.length);
             break;
         }
         else if (result == ACP_ERR_NEED_MORE_DATA)
         {
             printf("Partial frame, need more data\n");
-            // Put data back for next iteration
-            mock_serial_write(serial, read_buffer, total_read);
         }
         else
         {
@@ -375,6 +322,122 @@ static int test_partial_reads(mock_serial_t *serial)
     return 0;
 }
 
+/**
+ * @brief Reader thread state for the pipelined receive
+ */
+typedef struct
+{
+    mock_serial_t *serial; /**< Port owned by the reader thread */
+    acp_ring_t *ring;      /**< Ring the reader fills */
+    int done;              /**< Set once the port is drained */
+} serial_reader_t;
+
+/**
+ * @brief Reader thread: move bytes from the port into the ring
+ *
+ * Reads land directly in the ring's free space, in small chunks as a UART
+ * driver would deliver them; the thread never waits for the parser.
+ */
+static void *serial_reader_thread(void *arg)
+{
+    serial_reader_t *reader = (serial_reader_t *)arg;
+
+    while (mock_serial_available(reader->serial) > 0)
+    {
+        acp_ring_regions_t regions;
+        if (acp_ring_write_regions(reader->ring, &regions) == 0)
+        {
+            sched_yield(); // Ring full: parser is behind
+            continue;
+        }
+
+        size_t chunk = (regions.first_len < 7) ? regions.first_len : 7;
+        size_t bytes_read = mock_serial_read(reader->serial, regions.first, chunk);
+        acp_ring_produce(reader->ring, bytes_read);
+    }
+
+    __atomic_store_n(&reader->done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/**
+ * @brief Receive frames with ingest and parsing on separate threads
+ */
+static int receive_frames_pipelined(mock_serial_t *serial)
+{
+    printf("\n=== Pipelined Receive Test ===\n");
+
+    if (send_sample_frames(serial) != 0)
+    {
+        return -1;
+    }
+
+    static uint8_t ring_storage[256];
+    acp_ring_t ring;
+    acp_ring_init(&ring, ring_storage, sizeof(ring_storage));
+
+    static uint8_t decoder_buffer[ACP_DECODER_BUFFER_SIZE];
+    acp_decoder_t decoder;
+    acp_decoder_init(&decoder, decoder_buffer, sizeof(decoder_buffer));
+
+    serial_reader_t reader = {serial, &ring, 0};
+    pthread_t reader_thread;
+    if (pthread_create(&reader_thread, NULL, serial_reader_thread, &reader) != 0)
+    {
+        printf("Could not start reader thread\n");
+        return -1;
+    }
+
+    // Parse in place from the ring; the decoder absorbs each region it is given
+    int frame_count = 0;
+    for (;;)
+    {
+        int reader_done = __atomic_load_n(&reader.done, __ATOMIC_ACQUIRE);
+
+        acp_ring_regions_t regions;
+        size_t used = acp_ring_read_regions(&ring, &regions);
+        if (used == 0)
+        {
+            if (reader_done)
+            {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+
+        const uint8_t *spans[2] = {regions.first, regions.second};
+        size_t lens[2] = {regions.first_len, regions.second_len};
+        for (int s = 0; s < 2; s++)
+        {
+            size_t pos = 0;
+            while (pos < lens[s])
+            {
+                acp_frame_view_t view;
+                size_t consumed = 0;
+                acp_result_t result = acp_decoder_decode(&decoder, spans[s] + pos, lens[s] - pos,
+                                                         &consumed, &view, NULL);
+                pos += consumed;
+                if (result == ACP_OK)
+                {
+                    frame_count++;
+                    printf("✓ Frame %d decoded from ring: type %u, %u byte payload\n",
+                           frame_count, view.type, view.length);
+                }
+                else if (result != ACP_ERR_NEED_MORE_DATA)
+                {
+                    printf("✗ Frame rejected: %d\n", result);
+                }
+            }
+        }
+        acp_ring_consume(&ring, used);
+    }
+
+    pthread_join(reader_thread, NULL);
+    printf("Pipelined receive decoded %d frames\n", frame_count);
+    return frame_count;
+}
+
 /**
  * @brief Main mock serial example
  */
@@ -418,6 +481,13 @@ int main(void)
         goto cleanup;
     }
 
+    // Test reader thread and parser pipelined through a ring
+    if (receive_frames_pipelined(&serial) < 2)
+    {
+        printf("Pipelined receive test failed\n");
+        goto cleanup;
+    }
+
     printf("\n✓ Mock serial example completed successfully\n");
 
 cleanup:
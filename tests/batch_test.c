@@ -0,0 +1,514 @@
+/**
+ * @file batch_test.c
+ * @brief Batch encode and decode tests for ACP
+ *
+ * Encodes mixed batches with acp_encode_batch() and checks that every
+ * frame is byte-identical to the same frame encoded on its own, that
+ * sequence numbers are allocated as one block, and that a batch stopped
+ * by a full buffer or a policy error leaves complete frames behind.
+ * Decodes mixed streams with acp_decode_batch() and checks that bad
+ * frames are reported without losing their neighbours. Checks that
+ * acp_encode_frame_iov() matches encoding the concatenated payload.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+
+#define BATCH_FRAMES 8
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+static const size_t frame_sizes[BATCH_FRAMES] = {0, 5, 254, 255, 700, 31, ACP_MAX_PAYLOAD_SIZE, 64};
+
+static uint8_t payloads[BATCH_FRAMES][ACP_MAX_PAYLOAD_SIZE];
+static uint8_t batch_out[BATCH_FRAMES * (ACP_MAX_FRAME_SIZE + 64)];
+static uint8_t single_out[BATCH_FRAMES * (ACP_MAX_FRAME_SIZE + 64)];
+
+/* Segments: whole payload for even frames, split in three for odd ones */
+static acp_iovec_t segments[BATCH_FRAMES][3];
+static acp_encode_desc_t descs[BATCH_FRAMES];
+
+static uint8_t decode_arena[BATCH_FRAMES * ACP_DECODE_BUFFER_SIZE];
+
+static void build_batch(void)
+{
+    for (size_t f = 0; f < BATCH_FRAMES; f++)
+    {
+        size_t len = frame_sizes[f];
+        for (size_t i = 0; i < len; i++)
+        {
+            payloads[f][i] = (uint8_t)((i * 13 + f) % 241);
+        }
+
+        descs[f].type = (f % 3 == 1) ? ACP_FRAME_TYPE_COMMAND : ACP_FRAME_TYPE_TELEMETRY;
+        descs[f].flags = (f % 3 == 1 || f % 4 == 0) ? ACP_FLAG_AUTHENTICATED : 0;
+        descs[f].payload = segments[f];
+
+        if (f & 1)
+        {
+            size_t a = len / 3, b = len / 2;
+            segments[f][0].base = payloads[f];
+            segments[f][0].len = a;
+            segments[f][1].base = payloads[f] + a;
+            segments[f][1].len = b - a;
+            segments[f][2].base = payloads[f] + b;
+            segments[f][2].len = len - b;
+            descs[f].payload_count = 3;
+        }
+        else
+        {
+            segments[f][0].base = payloads[f];
+            segments[f][0].len = len;
+            descs[f].payload_count = 1;
+        }
+    }
+}
+
+/* Test batch output matches frames encoded one at a time */
+static int test_batch_matches_single(void)
+{
+    printf("\nTest 1: Batch matches per-frame encoding\n");
+    printf("========================================\n");
+
+    acp_session_t batch_session, single_session;
+    acp_session_init(&batch_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&single_session, 1, test_key, sizeof(test_key), 0x1234);
+
+    size_t offsets[BATCH_FRAMES];
+    size_t encoded = 0, batch_len = 0;
+    acp_result_t result = acp_encode_batch(descs, BATCH_FRAMES, &batch_session,
+                                           batch_out, sizeof(batch_out),
+                                           offsets, &encoded, &batch_len);
+    if (result != ACP_OK || encoded != BATCH_FRAMES)
+    {
+        printf("✗ Batch encode failed: %d (%zu frames)\n", result, encoded);
+        return 0;
+    }
+
+    size_t single_len = 0;
+    uint32_t auth_frames = 0;
+    for (size_t f = 0; f < BATCH_FRAMES; f++)
+    {
+        if (offsets[f] != single_len)
+        {
+            printf("✗ Frame %zu offset %zu, expected %zu\n", f, offsets[f], single_len);
+            return 0;
+        }
+
+        size_t out_len = sizeof(single_out) - single_len;
+        if (acp_encode_frame(descs[f].type, descs[f].flags, payloads[f], frame_sizes[f],
+                             &single_session, single_out + single_len, &out_len) != ACP_OK)
+        {
+            printf("✗ Single encode of frame %zu failed\n", f);
+            return 0;
+        }
+        single_len += out_len;
+        auth_frames += (descs[f].flags & ACP_FLAG_AUTHENTICATED) ? 1 : 0;
+    }
+
+    if (batch_len != single_len || memcmp(batch_out, single_out, batch_len) != 0)
+    {
+        printf("✗ Batch output differs from single-frame output\n");
+        return 0;
+    }
+    if (acp_session_get_next_sequence(&batch_session) != 1 + auth_frames)
+    {
+        printf("✗ next_sequence %llu, expected %u\n",
+               (unsigned long long)acp_session_get_next_sequence(&batch_session), 1 + auth_frames);
+        return 0;
+    }
+
+    /* Frames decode in order at the reported offsets */
+    acp_session_t rx_session;
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    for (size_t f = 0; f < BATCH_FRAMES; f++)
+    {
+        acp_frame_t frame;
+        size_t consumed = 0;
+        result = acp_decode_frame(batch_out + offsets[f], batch_len - offsets[f], &frame, &consumed, &rx_session);
+        if (result != ACP_OK || frame.length != frame_sizes[f] ||
+            memcmp(frame.payload, payloads[f], frame_sizes[f]) != 0)
+        {
+            printf("✗ Frame %zu did not decode: %d\n", f, result);
+            return 0;
+        }
+    }
+
+    printf("✓ %zu frames, %zu bytes, %u sequence numbers\n", encoded, batch_len, auth_frames);
+    return 1;
+}
+
+/* Test a full buffer stops the batch after complete frames */
+static int test_batch_buffer_full(void)
+{
+    printf("\nTest 2: Batch stopped by a full buffer\n");
+    printf("======================================\n");
+
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+
+    size_t offsets[BATCH_FRAMES];
+    size_t encoded = 0, first_len = 0;
+    acp_result_t result = acp_encode_batch(descs, BATCH_FRAMES, &session,
+                                           batch_out, 1500, offsets, &encoded, &first_len);
+    if (result != ACP_ERR_BUFFER_TOO_SMALL || encoded == 0 || encoded >= BATCH_FRAMES || first_len > 1500)
+    {
+        printf("✗ Expected a partial batch, got %d with %zu frames\n", result, encoded);
+        return 0;
+    }
+
+    uint32_t used = 0;
+    for (size_t f = 0; f < encoded; f++)
+    {
+        used += (descs[f].flags & ACP_FLAG_AUTHENTICATED) ? 1 : 0;
+    }
+    if (acp_session_get_next_sequence(&session) != 1 + used)
+    {
+        printf("✗ Sequence numbers consumed for frames not encoded\n");
+        return 0;
+    }
+
+    /* Resume with the remaining frames */
+    size_t rest = 0, rest_len = 0;
+    result = acp_encode_batch(descs + encoded, BATCH_FRAMES - encoded, &session,
+                              batch_out + first_len, sizeof(batch_out) - first_len,
+                              NULL, &rest, &rest_len);
+    if (result != ACP_OK || encoded + rest != BATCH_FRAMES)
+    {
+        printf("✗ Resumed batch failed: %d\n", result);
+        return 0;
+    }
+
+    /* Stitched output decodes as one stream */
+    acp_session_t rx_session;
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    size_t pos = 0;
+    for (size_t f = 0; f < BATCH_FRAMES; f++)
+    {
+        acp_frame_t frame;
+        size_t consumed = 0;
+        result = acp_decode_frame(batch_out + pos, first_len + rest_len - pos, &frame, &consumed, &rx_session);
+        if (result != ACP_OK || frame.length != frame_sizes[f])
+        {
+            printf("✗ Frame %zu did not decode after resume: %d\n", f, result);
+            return 0;
+        }
+        pos += consumed;
+    }
+
+    printf("✓ %zu frames in first pass, %zu after resume\n", encoded, rest);
+    return 1;
+}
+
+/* Test a policy error stops the batch at the offending frame */
+static int test_batch_policy_error(void)
+{
+    printf("\nTest 3: Batch stopped by a policy error\n");
+    printf("=======================================\n");
+
+    acp_encode_desc_t bad[3];
+    memcpy(bad, descs, sizeof(bad));
+    bad[1].type = ACP_FRAME_TYPE_COMMAND;
+    bad[1].flags = 0; /* Commands must be authenticated */
+
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+
+    size_t encoded = 0, out_len = 0;
+    acp_result_t result = acp_encode_batch(bad, 3, &session, batch_out, sizeof(batch_out),
+                                           NULL, &encoded, &out_len);
+    if (result != ACP_ERR_AUTH_REQUIRED || encoded != 1)
+    {
+        printf("✗ Expected AUTH_REQUIRED after 1 frame, got %d after %zu\n", result, encoded);
+        return 0;
+    }
+
+    result = acp_encode_batch(descs, 1, NULL, batch_out, sizeof(batch_out), NULL, &encoded, &out_len);
+    if (result != ACP_ERR_SESSION_NOT_INIT || encoded != 0 || out_len != 0)
+    {
+        printf("✗ Authenticated frame without session not rejected\n");
+        return 0;
+    }
+
+    printf("✓ Batch stops at the first invalid frame\n");
+    return 1;
+}
+
+/* Append one frame of payload index f to a stream, returning its offset */
+static size_t append_frame(uint8_t *stream, size_t *stream_len, size_t f, uint8_t flags, acp_session_t *session)
+{
+    size_t offset = *stream_len;
+    size_t out_len = sizeof(batch_out) - offset;
+    uint8_t type = (flags & ACP_FLAG_AUTHENTICATED) ? ACP_FRAME_TYPE_COMMAND : ACP_FRAME_TYPE_TELEMETRY;
+    if (acp_encode_frame(type, flags, payloads[f], frame_sizes[f], session, stream + offset, &out_len) == ACP_OK)
+    {
+        *stream_len += out_len;
+    }
+    return offset;
+}
+
+/* Flip bits in a byte without turning it into a delimiter */
+static void corrupt_byte(uint8_t *byte)
+{
+    *byte ^= (*byte == 0x40) ? 0x41 : 0x40;
+}
+
+/* Test a mixed stream decodes with per-frame errors */
+static int test_decode_batch_mixed(void)
+{
+    printf("\nTest 4: Batch decode of a mixed stream\n");
+    printf("======================================\n");
+
+    acp_session_t tx_session, rx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+
+    static const uint8_t garbage[] = {0x11, 0x22, 0x33};
+    size_t len = 0;
+    size_t off[6];
+    size_t ends[6];
+
+    off[0] = append_frame(batch_out, &len, 1, 0, &tx_session);
+    ends[0] = len;
+    memcpy(batch_out + len, garbage, sizeof(garbage));
+    len += sizeof(garbage);
+    off[1] = append_frame(batch_out, &len, 2, 0, &tx_session);
+    ends[1] = len;
+    corrupt_byte(&batch_out[off[1] + (ends[1] - off[1]) / 2]);
+    off[2] = append_frame(batch_out, &len, 3, ACP_FLAG_AUTHENTICATED, &tx_session);
+    ends[2] = len;
+    off[3] = append_frame(batch_out, &len, 5, ACP_FLAG_AUTHENTICATED, &tx_session);
+    ends[3] = len;
+    corrupt_byte(&batch_out[ends[3] - 1]); /* Last tag byte */
+    off[4] = append_frame(batch_out, &len, 4, 0, &tx_session);
+    ends[4] = len;
+    off[5] = append_frame(batch_out, &len, 7, ACP_FLAG_AUTHENTICATED, &tx_session);
+    ends[5] = len;
+
+    static const acp_result_t expected[5] = {ACP_OK, ACP_ERR_CRC_MISMATCH, ACP_OK, ACP_ERR_AUTH_FAILED, ACP_OK};
+    static const size_t expected_payload[5] = {1, 2, 3, 5, 4};
+
+    /* First pass sees the last frame cut in half */
+    acp_decode_result_t results[BATCH_FRAMES];
+    size_t count = 0, consumed = 0;
+    size_t partial_len = off[5] + (ends[5] - off[5]) / 2;
+    acp_result_t result = acp_decode_batch(batch_out, partial_len, decode_arena, sizeof(decode_arena),
+                                           results, BATCH_FRAMES, &count, &consumed, &rx_session);
+    if (result != ACP_OK || count != 5 || consumed != off[5])
+    {
+        printf("✗ Expected 5 frames up to offset %zu, got %d: %zu frames, %zu bytes\n",
+               off[5], result, count, consumed);
+        return 0;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (results[i].offset != off[i] || results[i].result != expected[i])
+        {
+            printf("✗ Frame %zu: result %d at %zu, expected %d at %zu\n",
+                   i, results[i].result, results[i].offset, expected[i], off[i]);
+            return 0;
+        }
+        if (expected[i] == ACP_OK)
+        {
+            size_t f = expected_payload[i];
+            if (results[i].length != ends[i] - off[i] || results[i].view.length != frame_sizes[f] ||
+                memcmp(results[i].view.payload, payloads[f], frame_sizes[f]) != 0)
+            {
+                printf("✗ Frame %zu decoded incorrectly\n", i);
+                return 0;
+            }
+        }
+        else if (results[i].view.payload != NULL)
+        {
+            printf("✗ Rejected frame %zu has a payload\n", i);
+            return 0;
+        }
+    }
+
+    /* Payloads of accepted frames are still intact after the whole batch */
+    if (memcmp(results[0].view.payload, payloads[1], frame_sizes[1]) != 0)
+    {
+        printf("✗ Earlier frame overwritten in the decode buffer\n");
+        return 0;
+    }
+
+    /* Rest of the stream arrives: decoding resumes at the partial frame */
+    result = acp_decode_batch(batch_out + consumed, len - consumed, decode_arena, sizeof(decode_arena),
+                              results, BATCH_FRAMES, &count, &consumed, &rx_session);
+    if (result != ACP_OK || count != 1 || results[0].result != ACP_OK ||
+        results[0].view.length != frame_sizes[7] || consumed != ends[5] - off[5])
+    {
+        printf("✗ Resumed decode failed: %d, %zu frames\n", result, count);
+        return 0;
+    }
+
+    printf("✓ 3 good, 2 rejected, partial frame completed on resume\n");
+    return 1;
+}
+
+/* Test result and decode buffer limits stop the batch cleanly */
+static int test_decode_batch_limits(void)
+{
+    printf("\nTest 5: Batch decode limits\n");
+    printf("===========================\n");
+
+    size_t len = 0;
+    size_t off[4];
+    for (size_t i = 0; i < 4; i++)
+    {
+        off[i] = append_frame(batch_out, &len, i + 1, 0, NULL);
+        batch_out[len++] = ACP_COBS_DELIMITER; /* Idle fill */
+    }
+
+    acp_decode_result_t results[BATCH_FRAMES];
+    size_t count = 0, consumed = 0;
+    acp_result_t result = acp_decode_batch(batch_out, len, decode_arena, sizeof(decode_arena),
+                                           results, 2, &count, &consumed, NULL);
+    if (result != ACP_OK || count != 2 || consumed > off[2])
+    {
+        printf("✗ max_results not honoured: %d, %zu frames\n", result, count);
+        return 0;
+    }
+
+    /* Decoded frames pack back to back; a new one needs a full frame of room */
+    result = acp_decode_batch(batch_out, len, decode_arena, ACP_DECODE_BUFFER_SIZE,
+                              results, BATCH_FRAMES, &count, &consumed, NULL);
+    if (result != ACP_OK || count != 1 || consumed > off[1])
+    {
+        printf("✗ Decode buffer limit not honoured: %d, %zu frames\n", result, count);
+        return 0;
+    }
+
+    result = acp_decode_batch(batch_out, len, decode_arena, ACP_DECODE_BUFFER_SIZE - 1,
+                              results, BATCH_FRAMES, &count, &consumed, NULL);
+    if (result != ACP_OK || count != 0 || consumed != 0)
+    {
+        printf("✗ Undersized decode buffer not honoured: %d, %zu frames\n", result, count);
+        return 0;
+    }
+
+    result = acp_decode_batch(batch_out, len, decode_arena, sizeof(decode_arena),
+                              results, BATCH_FRAMES, &count, &consumed, NULL);
+    if (result != ACP_OK || count != 4 || consumed != len - 1)
+    {
+        printf("✗ Idle delimiters not skipped: %d, %zu frames, %zu of %zu bytes\n", result, count, consumed, len);
+        return 0;
+    }
+
+    result = acp_decode_batch(NULL, len, decode_arena, sizeof(decode_arena),
+                              results, BATCH_FRAMES, &count, &consumed, NULL);
+    if (result != ACP_ERR_INVALID_PARAM)
+    {
+        printf("✗ NULL input not rejected\n");
+        return 0;
+    }
+
+    printf("✓ Batch stops at result and buffer limits\n");
+    return 1;
+}
+
+/* Test a scattered payload encodes like the concatenated one */
+static int test_encode_frame_iov(void)
+{
+    printf("\nTest 6: Scatter-gather frame encoding\n");
+    printf("=====================================\n");
+
+    acp_session_t iov_session, flat_session;
+    acp_session_init(&iov_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&flat_session, 1, test_key, sizeof(test_key), 0x1234);
+
+    for (size_t f = 0; f < BATCH_FRAMES; f++)
+    {
+        size_t iov_len = ACP_MAX_FRAME_SIZE + 64;
+        size_t flat_len = ACP_MAX_FRAME_SIZE + 64;
+        acp_result_t iov_result = acp_encode_frame_iov(descs[f].type, descs[f].flags,
+                                                       descs[f].payload, descs[f].payload_count,
+                                                       &iov_session, batch_out, &iov_len);
+        acp_result_t flat_result = acp_encode_frame(descs[f].type, descs[f].flags,
+                                                    payloads[f], frame_sizes[f],
+                                                    &flat_session, single_out, &flat_len);
+        if (iov_result != ACP_OK || flat_result != ACP_OK || iov_len != flat_len ||
+            memcmp(batch_out, single_out, iov_len) != 0)
+        {
+            printf("✗ Frame %zu differs: %d/%d, %zu/%zu bytes\n", f, iov_result, flat_result, iov_len, flat_len);
+            return 0;
+        }
+    }
+    if (acp_session_get_next_sequence(&iov_session) != acp_session_get_next_sequence(&flat_session))
+    {
+        printf("✗ Sequence numbers diverged\n");
+        return 0;
+    }
+
+    /* Oversized total payload and a missing segment array are rejected */
+    acp_iovec_t big[2] = {{payloads[6], ACP_MAX_PAYLOAD_SIZE}, {payloads[1], 1}};
+    size_t out_len = sizeof(batch_out);
+    if (acp_encode_frame_iov(ACP_FRAME_TYPE_TELEMETRY, 0, big, 2, NULL, batch_out, &out_len) != ACP_ERR_PAYLOAD_TOO_LARGE)
+    {
+        printf("✗ Oversized scattered payload not rejected\n");
+        return 0;
+    }
+    out_len = sizeof(batch_out);
+    if (acp_encode_frame_iov(ACP_FRAME_TYPE_TELEMETRY, 0, NULL, 1, NULL, batch_out, &out_len) != ACP_ERR_INVALID_PARAM)
+    {
+        printf("✗ NULL segment array not rejected\n");
+        return 0;
+    }
+
+    /* Too small a buffer reports the size needed */
+    out_len = 32;
+    if (acp_encode_frame_iov(descs[4].type, descs[4].flags, descs[4].payload, descs[4].payload_count,
+                             &iov_session, batch_out, &out_len) != ACP_ERR_BUFFER_TOO_SMALL)
+    {
+        printf("✗ Small buffer not rejected\n");
+        return 0;
+    }
+
+    printf("✓ Scattered payloads encode identically to contiguous ones\n");
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Batch Tests\n");
+    printf("===============\n");
+
+    build_batch();
+
+    int tests_passed = 0;
+    int total_tests = 6;
+
+    if (test_batch_matches_single())
+        tests_passed++;
+    if (test_batch_buffer_full())
+        tests_passed++;
+    if (test_batch_policy_error())
+        tests_passed++;
+    if (test_decode_batch_mixed())
+        tests_passed++;
+    if (test_decode_batch_limits())
+        tests_passed++;
+    if (test_encode_frame_iov())
+        tests_passed++;
+
+    printf("\n===============\n");
+    printf("Batch Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All batch tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some batch tests FAILED\n");
+    return 1;
+}
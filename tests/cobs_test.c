@@ -0,0 +1,373 @@
+/**
+ * @file cobs_test.c
+ * @brief COBS encoder/decoder tests for ACP
+ *
+ * Checks the one-shot and streaming COBS encoders against the decoders on
+ * edge cases (trailing zeros, full 254-byte blocks followed by zeros) and
+ * that frames whose CRC high byte is zero survive the wire, plus the bulk
+ * streaming decoder feed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+#include "acp_cobs.h"
+#include "acp_crc16.h"
+
+/* Encode, check no zeros in output, and decode back through both decoders */
+static int cobs_roundtrip(const uint8_t *data, size_t len)
+{
+    uint8_t encoded[2048];
+    uint8_t decoded[2048];
+    size_t encoded_len = 0;
+    size_t decoded_len = 0;
+
+    if (acp_cobs_encode(data, len, encoded, sizeof(encoded), &encoded_len) != ACP_OK)
+    {
+        return 0;
+    }
+    if (encoded_len > acp_cobs_max_encoded_size(len) || memchr(encoded, 0, encoded_len) != NULL)
+    {
+        return 0;
+    }
+
+    if (acp_cobs_decode(encoded, encoded_len, decoded, sizeof(decoded), &decoded_len) != ACP_OK ||
+        decoded_len != len || memcmp(decoded, data, len) != 0)
+    {
+        return 0;
+    }
+
+    /* Fused decoder expects the closing delimiter */
+    size_t consumed = 0;
+    uint16_t crc = 0;
+    encoded[encoded_len] = ACP_COBS_DELIMITER;
+    if (acp_cobs_decode_crc16(encoded, encoded_len + 1, decoded, sizeof(decoded),
+                              &decoded_len, &consumed, &crc) != ACP_OK ||
+        decoded_len != len || consumed != encoded_len + 1 || memcmp(decoded, data, len) != 0)
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+/* Test encoder edge cases that previously lost zero bytes */
+static int test_edge_cases(void)
+{
+    printf("\nTest 1: COBS edge cases\n");
+    printf("=======================\n");
+
+    uint8_t buf[1024];
+    int failures = 0;
+
+    static const uint8_t trailing_zero[] = {0x11, 0x22, 0x00};
+    static const uint8_t only_zeros[] = {0x00, 0x00, 0x00};
+    static const uint8_t single_zero[] = {0x00};
+
+    if (!cobs_roundtrip(trailing_zero, sizeof(trailing_zero)))
+    {
+        printf("✗ Trailing zero lost\n");
+        failures++;
+    }
+    if (!cobs_roundtrip(only_zeros, sizeof(only_zeros)) ||
+        !cobs_roundtrip(single_zero, sizeof(single_zero)))
+    {
+        printf("✗ All-zero input mismatch\n");
+        failures++;
+    }
+    if (!cobs_roundtrip(buf, 0))
+    {
+        printf("✗ Empty input mismatch\n");
+        failures++;
+    }
+
+    /* Full 254-byte blocks, with and without a following zero */
+    static const size_t block_lens[] = {253, 254, 255, 508, 509};
+    for (size_t b = 0; b < sizeof(block_lens) / sizeof(block_lens[0]); b++)
+    {
+        size_t n = block_lens[b];
+        memset(buf, 0xA5, n);
+        if (!cobs_roundtrip(buf, n))
+        {
+            printf("✗ %zu non-zero bytes mismatch\n", n);
+            failures++;
+        }
+        buf[n] = 0x00;
+        if (!cobs_roundtrip(buf, n + 1))
+        {
+            printf("✗ %zu non-zero bytes + zero mismatch\n", n);
+            failures++;
+        }
+        buf[n + 1] = 0x42;
+        if (!cobs_roundtrip(buf, n + 2))
+        {
+            printf("✗ %zu non-zero bytes + zero + data mismatch\n", n);
+            failures++;
+        }
+    }
+
+    if (failures == 0)
+    {
+        printf("✓ Trailing zeros and full-block boundaries round-trip\n");
+    }
+    return failures == 0;
+}
+
+/* Test that writing in pieces matches the one-shot encoder */
+static int test_streaming_matches_oneshot(void)
+{
+    printf("\nTest 2: Streaming encoder matches one-shot\n");
+    printf("==========================================\n");
+
+    uint8_t data[1000];
+    uint32_t state = 0x12345678;
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        state = state * 1103515245u + 12345u;
+        /* Roughly one zero in eight, plus long zero-free stretches */
+        data[i] = ((state >> 16) & 7) == 0 ? 0 : (uint8_t)(state >> 24);
+    }
+    memset(data + 300, 0x7E, 400);
+
+    uint8_t expected[1100];
+    size_t expected_len = 0;
+    if (acp_cobs_encode(data, sizeof(data), expected, sizeof(expected), &expected_len) != ACP_OK)
+    {
+        printf("✗ One-shot encode failed\n");
+        return 0;
+    }
+
+    static const size_t chunk_sizes[] = {1, 3, 7, 254, 255, 999};
+    for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++)
+    {
+        uint8_t out[1100];
+        acp_cobs_encoder_t encoder;
+        size_t out_len = 0;
+        uint16_t crc = acp_crc16_init();
+
+        acp_cobs_encoder_init(&encoder, out, sizeof(out));
+        for (size_t off = 0; off < sizeof(data); off += chunk_sizes[c])
+        {
+            size_t n = sizeof(data) - off < chunk_sizes[c] ? sizeof(data) - off : chunk_sizes[c];
+            /* Alternate plain and CRC-fused writes */
+            if ((off / chunk_sizes[c]) & 1)
+            {
+                acp_cobs_encoder_write(&encoder, data + off, n);
+                crc = acp_crc16_update(crc, data + off, n);
+            }
+            else
+            {
+                acp_cobs_encoder_write_crc16(&encoder, data + off, n, &crc);
+            }
+        }
+
+        if (acp_cobs_encoder_finish(&encoder, &out_len) != ACP_OK || out_len != expected_len ||
+            memcmp(out, expected, expected_len) != 0)
+        {
+            printf("✗ Chunk size %zu output differs\n", chunk_sizes[c]);
+            return 0;
+        }
+        if (acp_crc16_finalize(crc) != acp_crc16_calculate(data, sizeof(data)))
+        {
+            printf("✗ Chunk size %zu CRC differs\n", chunk_sizes[c]);
+            return 0;
+        }
+    }
+    printf("✓ Chunked streaming output and CRC match one-shot\n");
+
+    /* Overflow is sticky and reported at finish */
+    uint8_t small[8];
+    acp_cobs_encoder_t encoder;
+    size_t out_len = 0;
+    acp_cobs_encoder_init(&encoder, small, sizeof(small));
+    acp_cobs_encoder_write(&encoder, data + 300, 16);
+    if (acp_cobs_encoder_finish(&encoder, &out_len) != ACP_ERR_BUFFER_TOO_SMALL)
+    {
+        printf("✗ Overflow not reported\n");
+        return 0;
+    }
+    printf("✓ Output overflow reported\n");
+
+    return 1;
+}
+
+/* Test frames whose CRC high byte is zero (last wire byte before COBS is 0) */
+static int test_zero_crc_high_byte(void)
+{
+    printf("\nTest 3: Frames with zero CRC high byte\n");
+    printf("======================================\n");
+
+    int found = 0;
+    for (uint32_t seed = 0; seed < 4096 && found < 4; seed++)
+    {
+        uint8_t payload[4];
+        payload[0] = (uint8_t)seed;
+        payload[1] = (uint8_t)(seed >> 8);
+        payload[2] = 0x5A;
+        payload[3] = 0x00;
+
+        uint8_t encoded[64];
+        size_t encoded_len = 0;
+        acp_frame_t frame = {0};
+        frame.version = ACP_PROTOCOL_VERSION;
+        frame.type = ACP_FRAME_TYPE_TELEMETRY;
+        frame.length = sizeof(payload);
+        memcpy(frame.payload, payload, sizeof(payload));
+
+        if (acp_frame_encode(&frame, encoded, sizeof(encoded), &encoded_len) != ACP_OK)
+        {
+            printf("✗ Encode failed for seed %u\n", seed);
+            return 0;
+        }
+
+        uint8_t header[6] = {ACP_PROTOCOL_VERSION, ACP_FRAME_TYPE_TELEMETRY, 0, 0, 0, sizeof(payload)};
+        uint16_t crc = acp_crc16_init();
+        crc = acp_crc16_update(crc, header, sizeof(header));
+        crc = acp_crc16_finalize(acp_crc16_update(crc, payload, sizeof(payload)));
+        if ((crc >> 8) != 0)
+        {
+            continue;
+        }
+        found++;
+
+        acp_frame_t decoded;
+        size_t consumed = 0;
+        if (acp_frame_decode(encoded, encoded_len, &decoded, &consumed) != ACP_OK ||
+            consumed != encoded_len || decoded.length != sizeof(payload) ||
+            memcmp(decoded.payload, payload, sizeof(payload)) != 0)
+        {
+            printf("✗ Frame with CRC 0x%04X failed to round-trip\n", crc);
+            return 0;
+        }
+    }
+
+    if (found == 0)
+    {
+        printf("✗ No frame with zero CRC high byte found\n");
+        return 0;
+    }
+    printf("✓ %d frames with zero CRC high byte round-trip\n", found);
+    return 1;
+}
+
+/* Test bulk feed reports every frame in a chunk */
+static int test_decoder_feed(void)
+{
+    printf("\nTest 4: Bulk decoder feed\n");
+    printf("=========================\n");
+
+    /* Three frames with idle delimiters between them, in one stream */
+    static const uint8_t frames[3][5] = {
+        {0x01, 0x02, 0x00, 0x03, 0x04},
+        {0x00, 0x00, 0x00, 0x00, 0x00},
+        {0xFF, 0xFE, 0xFD, 0x00, 0xFC}};
+    uint8_t stream[64];
+    size_t stream_len = 0;
+    for (size_t f = 0; f < 3; f++)
+    {
+        size_t encoded_len = 0;
+        stream[stream_len++] = ACP_COBS_DELIMITER;
+        acp_cobs_encode(frames[f], sizeof(frames[f]), stream + stream_len,
+                        sizeof(stream) - stream_len, &encoded_len);
+        stream_len += encoded_len;
+        stream[stream_len++] = ACP_COBS_DELIMITER;
+    }
+
+    static const size_t chunk_sizes[] = {1, 4, 9, sizeof(stream)};
+    for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++)
+    {
+        uint8_t buffer[32];
+        acp_cobs_decoder_t decoder;
+        acp_cobs_decoder_init(&decoder, buffer, sizeof(buffer));
+
+        size_t found = 0;
+        for (size_t off = 0; off < stream_len; off += chunk_sizes[c])
+        {
+            const uint8_t *chunk = stream + off;
+            size_t chunk_len = (stream_len - off < chunk_sizes[c]) ? stream_len - off : chunk_sizes[c];
+
+            while (chunk_len > 0)
+            {
+                size_t consumed = 0;
+                int result = acp_cobs_decoder_feed(&decoder, chunk, chunk_len, &consumed);
+                if (result < 0 || consumed == 0 || consumed > chunk_len)
+                {
+                    printf("✗ Feed failed (%d) with %zu-byte chunks\n", result, chunk_sizes[c]);
+                    return 0;
+                }
+                chunk += consumed;
+                chunk_len -= consumed;
+
+                if (result == 1)
+                {
+                    uint8_t decoded[32];
+                    size_t decoded_len = 0;
+                    if (found >= 3 ||
+                        acp_cobs_decoder_get_frame(&decoder, decoded, sizeof(decoded), &decoded_len) != ACP_OK ||
+                        decoded_len != sizeof(frames[found]) ||
+                        memcmp(decoded, frames[found], decoded_len) != 0)
+                    {
+                        printf("✗ Frame %zu mismatch with %zu-byte chunks\n", found, chunk_sizes[c]);
+                        return 0;
+                    }
+                    found++;
+                }
+            }
+        }
+
+        if (found != 3)
+        {
+            printf("✗ Found %zu of 3 frames with %zu-byte chunks\n", found, chunk_sizes[c]);
+            return 0;
+        }
+    }
+    printf("✓ All frame boundaries reported for every chunk size\n");
+
+    /* Overflow puts the decoder in the error state until reset */
+    uint8_t tiny[4];
+    acp_cobs_decoder_t decoder;
+    size_t consumed = 0;
+    acp_cobs_decoder_init(&decoder, tiny, sizeof(tiny));
+    if (acp_cobs_decoder_feed(&decoder, stream + 1, stream_len - 1, &consumed) != ACP_ERR_BUFFER_TOO_SMALL ||
+        acp_cobs_decoder_get_state(&decoder) != ACP_COBS_DECODER_ERROR)
+    {
+        printf("✗ Overflow not reported\n");
+        return 0;
+    }
+    printf("✓ Buffer overflow reported\n");
+
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP COBS Tests\n");
+    printf("==============\n");
+
+    int tests_passed = 0;
+    int total_tests = 4;
+
+    if (test_edge_cases())
+        tests_passed++;
+    if (test_streaming_matches_oneshot())
+        tests_passed++;
+    if (test_zero_crc_high_byte())
+        tests_passed++;
+    if (test_decoder_feed())
+        tests_passed++;
+
+    printf("\n==============\n");
+    printf("COBS Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All COBS tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some COBS tests FAILED\n");
+    return 1;
+}
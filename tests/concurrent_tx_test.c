@@ -0,0 +1,387 @@
+/**
+ * @file concurrent_tx_test.c
+ * @brief Concurrent transmit tests for ACP
+ *
+ * Checks sequence reservation and per-thread blocks on their own, that a
+ * batch in concurrent mode takes its numbers as one block, and then runs
+ * several producer threads on one session, both through acp_encode_frame()
+ * and through per-thread blocks with acp_encode_frame_seq(). Every frame
+ * must verify and no sequence number may be used twice. Also checks the
+ * transmit counter, receive state and key material sit on separate cache
+ * lines.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "acp_protocol.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#define CONCURRENT_TEST_THREADS 1
+#endif
+
+#define PRODUCERS 4
+#define FRAMES_PER_PRODUCER 2000
+#define FRAME_SLOT 96
+#define BLOCK_SIZE 16
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+/* Test reservation, block refill and expiry without extended sequences */
+static int test_reservation(void)
+{
+    printf("\nTest 1: Sequence reservation\n");
+    printf("============================\n");
+
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+
+    uint64_t first = 0;
+    if (acp_session_reserve_sequences(NULL, 1, &first) != ACP_ERR_INVALID_PARAM ||
+        acp_session_reserve_sequences(&session, 0, &first) != ACP_ERR_INVALID_PARAM ||
+        acp_session_reserve_sequences(&session, 1, NULL) != ACP_ERR_INVALID_PARAM)
+    {
+        printf("✗ Bad reservation arguments not rejected\n");
+        return 0;
+    }
+
+    if (acp_session_reserve_sequences(&session, 10, &first) != ACP_OK || first != 1 ||
+        acp_session_get_next_sequence(&session) != 11)
+    {
+        printf("✗ Reservation did not take a consecutive block\n");
+        return 0;
+    }
+
+    acp_seq_block_t block;
+    if (acp_seq_block_init(&block, &session, 0) != ACP_ERR_INVALID_PARAM ||
+        acp_seq_block_init(&block, &session, 4) != ACP_OK)
+    {
+        printf("✗ Block initialization checks wrong\n");
+        return 0;
+    }
+    for (uint64_t expected = 11; expected < 19; expected++)
+    {
+        uint64_t sequence;
+        if (acp_seq_block_take(&block, &sequence) != ACP_OK || sequence != expected)
+        {
+            printf("✗ Block handed out %llu, expected %llu\n",
+                   (unsigned long long)sequence, (unsigned long long)expected);
+            return 0;
+        }
+    }
+    if (acp_session_get_next_sequence(&session) != 19)
+    {
+        printf("✗ Two blocks of 4 should leave the counter at 19\n");
+        return 0;
+    }
+
+    /* A block straddling the 32-bit limit expires the session */
+    acp_session_set_next_sequence(&session, UINT32_MAX - 1);
+    if (acp_session_reserve_sequences(&session, 2, &first) != ACP_OK ||
+        acp_session_reserve_sequences(&session, 2, &first) != ACP_ERR_SESSION_EXPIRED)
+    {
+        printf("✗ Reservation past UINT32_MAX not refused\n");
+        return 0;
+    }
+
+    acp_session_set_extended_sequence(&session, true);
+    if (acp_session_reserve_sequences(&session, 2, &first) != ACP_OK ||
+        first != (uint64_t)UINT32_MAX + 3)
+    {
+        printf("✗ Extended sequences should allow reservation past UINT32_MAX\n");
+        return 0;
+    }
+
+    printf("✓ Blocks consecutive, refilled on demand, expiry enforced\n");
+    return 1;
+}
+
+/* Test a batch in concurrent mode reserves its authenticated frames up front */
+static int test_batch_reservation(void)
+{
+    printf("\nTest 2: Batch reservation\n");
+    printf("=========================\n");
+
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_set_concurrent_tx(&session, true);
+
+    uint8_t payload[32];
+    memset(payload, 0x5a, sizeof(payload));
+    acp_iovec_t segment = {payload, sizeof(payload)};
+    acp_encode_desc_t descs[4] = {
+        {ACP_FRAME_TYPE_TELEMETRY, ACP_FLAG_AUTHENTICATED, &segment, 1},
+        {ACP_FRAME_TYPE_TELEMETRY, 0, &segment, 1},
+        {ACP_FRAME_TYPE_TELEMETRY, ACP_FLAG_AUTHENTICATED, &segment, 1},
+        {ACP_FRAME_TYPE_TELEMETRY, ACP_FLAG_AUTHENTICATED, &segment, 1},
+    };
+
+    uint8_t output[4 * FRAME_SLOT];
+    size_t encoded = 0;
+    size_t output_len = 0;
+    if (acp_encode_batch(descs, 4, &session, output, sizeof(output), NULL, &encoded, &output_len) != ACP_OK ||
+        encoded != 4 || acp_session_get_next_sequence(&session) != 4)
+    {
+        printf("✗ Full batch should take sequences 1-3\n");
+        return 0;
+    }
+
+    /* Room for one frame only: the rest of the reserved block is skipped */
+    if (acp_encode_batch(descs, 4, &session, output, FRAME_SLOT, NULL, &encoded, &output_len) !=
+            ACP_ERR_BUFFER_TOO_SMALL ||
+        encoded != 1 || acp_session_get_next_sequence(&session) != 7)
+    {
+        printf("✗ Partial batch should still consume its whole block\n");
+        return 0;
+    }
+
+    acp_session_t rx;
+    acp_session_init(&rx, 1, test_key, sizeof(test_key), 0x1234);
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+    acp_frame_view_t view;
+    size_t consumed;
+    if (acp_decode_frame_view(output, output_len, decode_buf, sizeof(decode_buf), &view, &consumed, &rx) != ACP_OK ||
+        view.sequence != 4)
+    {
+        printf("✗ First frame of the second batch should carry sequence 4\n");
+        return 0;
+    }
+
+    printf("✓ Batch reserved one block, unused numbers skipped on failure\n");
+    return 1;
+}
+
+/* Test the sender and receiver write different cache lines */
+static int test_layout(void)
+{
+    printf("\nTest 3: Session cache-line layout\n");
+    printf("=================================\n");
+
+    size_t tx = offsetof(acp_session_t, next_sequence);
+    size_t rx = offsetof(acp_session_t, last_accepted_seq);
+    size_t rx_end = offsetof(acp_session_t, replay_bitmap) + sizeof(((acp_session_t *)0)->replay_bitmap);
+    size_t keys = offsetof(acp_session_t, hmac);
+    if (rx - tx < ACP_CACHE_LINE_SIZE || keys < rx_end ||
+        keys / ACP_CACHE_LINE_SIZE == (rx_end - 1) / ACP_CACHE_LINE_SIZE)
+    {
+        printf("✗ Sections share a cache line: tx %zu, rx %zu-%zu, keys %zu\n", tx, rx, rx_end, keys);
+        return 0;
+    }
+
+    printf("✓ tx at %zu, rx at %zu-%zu, keys at %zu\n", tx, rx, rx_end, keys);
+    return 1;
+}
+
+#ifdef CONCURRENT_TEST_THREADS
+
+static uint8_t frames[PRODUCERS][FRAMES_PER_PRODUCER][FRAME_SLOT];
+static size_t frame_lens[PRODUCERS][FRAMES_PER_PRODUCER];
+static uint8_t seen[PRODUCERS * FRAMES_PER_PRODUCER + PRODUCERS * BLOCK_SIZE + 1];
+
+typedef struct
+{
+    acp_session_t *session;
+    int index;
+    int use_blocks;
+    int failures;
+} producer_t;
+
+static void *producer_main(void *arg)
+{
+    producer_t *producer = (producer_t *)arg;
+    acp_seq_block_t block;
+    acp_seq_block_init(&block, producer->session, BLOCK_SIZE);
+
+    uint8_t payload[40];
+    for (int i = 0; i < FRAMES_PER_PRODUCER; i++)
+    {
+        memset(payload, (uint8_t)(producer->index * 16 + i), sizeof(payload));
+        acp_iovec_t segment = {payload, sizeof(payload)};
+        size_t len = FRAME_SLOT;
+        acp_result_t result;
+        if (producer->use_blocks)
+        {
+            uint64_t sequence;
+            result = acp_seq_block_take(&block, &sequence);
+            if (result == ACP_OK)
+            {
+                result = acp_encode_frame_seq(ACP_FRAME_TYPE_TELEMETRY, &segment, 1, producer->session,
+                                              sequence, frames[producer->index][i], &len);
+            }
+        }
+        else
+        {
+            result = acp_encode_frame_iov(ACP_FRAME_TYPE_TELEMETRY, ACP_FLAG_AUTHENTICATED, &segment, 1,
+                                          producer->session, frames[producer->index][i], &len);
+        }
+        if (result != ACP_OK)
+        {
+            producer->failures++;
+            len = 0;
+        }
+        frame_lens[producer->index][i] = len;
+    }
+    return NULL;
+}
+
+/* Run producers on one session and check every frame verifies with a unique sequence */
+static int run_producers(int use_blocks, uint64_t *max_sequence)
+{
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_set_concurrent_tx(&session, true);
+
+    pthread_t threads[PRODUCERS];
+    producer_t producers[PRODUCERS];
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        producers[p].session = &session;
+        producers[p].index = p;
+        producers[p].use_blocks = use_blocks;
+        producers[p].failures = 0;
+        if (pthread_create(&threads[p], NULL, producer_main, &producers[p]) != 0)
+        {
+            printf("✗ Could not start producer thread\n");
+            return 0;
+        }
+    }
+    int failures = 0;
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        pthread_join(threads[p], NULL);
+        failures += producers[p].failures;
+    }
+    if (failures != 0)
+    {
+        printf("✗ %d encodes failed\n", failures);
+        return 0;
+    }
+
+    /* Decode each frame independently; a fresh session accepts any sequence */
+    memset(seen, 0, sizeof(seen));
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+    *max_sequence = 0;
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        for (int i = 0; i < FRAMES_PER_PRODUCER; i++)
+        {
+            acp_session_t rx;
+            acp_session_init(&rx, 1, test_key, sizeof(test_key), 0x1234);
+            acp_frame_view_t view;
+            size_t consumed;
+            if (acp_decode_frame_view(frames[p][i], frame_lens[p][i], decode_buf, sizeof(decode_buf),
+                                      &view, &consumed, &rx) != ACP_OK)
+            {
+                printf("✗ Frame %d from producer %d did not verify\n", i, p);
+                return 0;
+            }
+            if (view.sequence == 0 || view.sequence >= sizeof(seen) || seen[view.sequence])
+            {
+                printf("✗ Sequence %u out of range or used twice\n", view.sequence);
+                return 0;
+            }
+            seen[view.sequence] = 1;
+            if (view.sequence > *max_sequence)
+            {
+                *max_sequence = view.sequence;
+            }
+        }
+    }
+
+    if (acp_session_get_next_sequence(&session) <= *max_sequence)
+    {
+        printf("✗ Session counter %llu behind the highest sequence sent\n",
+               (unsigned long long)acp_session_get_next_sequence(&session));
+        return 0;
+    }
+    return 1;
+}
+
+/* Test threads encoding on one session through the normal encode call */
+static int test_threaded_encode(void)
+{
+    printf("\nTest 4: Concurrent acp_encode_frame_iov()\n");
+    printf("=========================================\n");
+
+    uint64_t max_sequence;
+    if (!run_producers(0, &max_sequence))
+    {
+        return 0;
+    }
+    if (max_sequence != PRODUCERS * FRAMES_PER_PRODUCER)
+    {
+        printf("✗ Sequences should be exactly 1-%d, highest was %llu\n",
+               PRODUCERS * FRAMES_PER_PRODUCER, (unsigned long long)max_sequence);
+        return 0;
+    }
+
+    printf("✓ %d producers sent %d frames with no gaps or repeats\n",
+           PRODUCERS, PRODUCERS * FRAMES_PER_PRODUCER);
+    return 1;
+}
+
+/* Test threads encoding from per-thread sequence blocks */
+static int test_threaded_blocks(void)
+{
+    printf("\nTest 5: Per-thread sequence blocks\n");
+    printf("==================================\n");
+
+    uint64_t max_sequence;
+    if (!run_producers(1, &max_sequence))
+    {
+        return 0;
+    }
+
+    printf("✓ %d producers with blocks of %d sent %d unique frames\n",
+           PRODUCERS, BLOCK_SIZE, PRODUCERS * FRAMES_PER_PRODUCER);
+    return 1;
+}
+
+#endif /* CONCURRENT_TEST_THREADS */
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Concurrent Transmit Tests\n");
+    printf("=============================\n");
+
+    acp_init();
+
+    int tests_passed = 0;
+    int total_tests = 3;
+
+    if (test_reservation())
+        tests_passed++;
+    if (test_batch_reservation())
+        tests_passed++;
+    if (test_layout())
+        tests_passed++;
+#ifdef CONCURRENT_TEST_THREADS
+    total_tests += 2;
+    if (test_threaded_encode())
+        tests_passed++;
+    if (test_threaded_blocks())
+        tests_passed++;
+#endif
+
+    acp_cleanup();
+
+    printf("\n=============================\n");
+    printf("Concurrent Transmit Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All concurrent transmit tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some concurrent transmit tests FAILED\n");
+    return 1;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file crc16_test.c
+ * @brief CRC16-CCITT tests for ACP
+ *
+ * Checks the built-in test vectors and cross-checks the optimised update
+ * path against a bit-at-a-time reference on random data, lengths,
+ * alignments and split points, for every kernel available on the CPU.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_crc16.h"
+#include "acp_cpu.h"
+#include "acp_errors.h"
+
+#define CRC_MAX_LEN 2048
+#define CRC_MAX_ALIGN 64
+
+static uint8_t buffer[CRC_MAX_ALIGN + CRC_MAX_LEN];
+
+/* Bit-at-a-time CRC16-CCITT reference (poly 0x1021, init 0xFFFF) */
+static uint16_t reference_crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = ACP_CRC16_INIT;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ ACP_CRC16_POLY) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint32_t rng_state = 0xC0FFEE11u;
+
+static uint32_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* Test the built-in known-answer vectors */
+static int test_self_test_vectors(void)
+{
+    printf("\nTest 1: Known-answer vectors\n");
+    printf("============================\n");
+
+    int failures = acp_crc16_self_test();
+    if (failures != 0)
+    {
+        printf("✗ %d self-test vectors failed\n", failures);
+        return 0;
+    }
+
+    size_t count = 0;
+    const acp_crc16_test_vector_t *vectors = acp_crc16_get_test_vectors(&count);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (reference_crc16(vectors[i].data, vectors[i].length) != vectors[i].expected_crc)
+        {
+            printf("✗ Reference disagrees with vector '%s'\n", vectors[i].name);
+            return 0;
+        }
+    }
+    printf("✓ %zu vectors pass\n", count);
+    return 1;
+}
+
+/* Test optimised path against the reference on random inputs */
+static int test_random_cross_check(void)
+{
+    printf("\nTest 2: Random cross-check against bitwise reference\n");
+    printf("====================================================\n");
+
+    for (size_t i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = (uint8_t)next_random();
+    }
+
+    for (int iter = 0; iter < 4000; iter++)
+    {
+        size_t len = (iter < 200) ? (size_t)iter : next_random() % CRC_MAX_LEN;
+        size_t align = next_random() % CRC_MAX_ALIGN;
+        const uint8_t *data = buffer + align;
+
+        uint16_t expected = reference_crc16(data, len);
+        if (acp_crc16_calculate(data, len) != expected)
+        {
+            printf("✗ Mismatch: len=%zu align=%zu\n", len, align);
+            return 0;
+        }
+
+        /* Incremental updates split at an arbitrary point must agree */
+        size_t split = len ? next_random() % (len + 1) : 0;
+        uint16_t crc = acp_crc16_init();
+        crc = acp_crc16_update(crc, data, split);
+        crc = acp_crc16_update(crc, data + split, len - split);
+        if (acp_crc16_finalize(crc) != expected)
+        {
+            printf("✗ Split mismatch: len=%zu split=%zu\n", len, split);
+            return 0;
+        }
+    }
+    printf("✓ 4000 random lengths and alignments match\n");
+    return 1;
+}
+
+/* Test every available kernel against the table kernel and the reference */
+static int test_kernel_cross_check(void)
+{
+    printf("\nTest 3: Kernel cross-check\n");
+    printf("==========================\n");
+
+    acp_crc16_kernel_t auto_kernel = acp_crc16_get_kernel();
+    printf("  auto-selected kernel: %s\n", acp_crc16_kernel_name(auto_kernel));
+
+    if (acp_crc16_set_kernel(ACP_CRC16_KERNEL_TABLE) != ACP_OK)
+    {
+        printf("✗ Table kernel must always be available\n");
+        return 0;
+    }
+
+    int ok = 1;
+    for (int k = ACP_CRC16_KERNEL_TABLE; k < ACP_CRC16_KERNEL_COUNT && ok; k++)
+    {
+        acp_crc16_kernel_t kernel = (acp_crc16_kernel_t)k;
+        if (acp_crc16_set_kernel(kernel) != ACP_OK)
+        {
+            printf("  %s: not available, skipped\n", acp_crc16_kernel_name(kernel));
+            continue;
+        }
+
+        for (int iter = 0; iter < 3000 && ok; iter++)
+        {
+            /* Cover every block-count boundary of the folding loops first */
+            size_t len = (iter < 300) ? (size_t)iter : next_random() % CRC_MAX_LEN;
+            size_t align = next_random() % CRC_MAX_ALIGN;
+            const uint8_t *data = buffer + align;
+            uint16_t seed = (uint16_t)next_random();
+
+            uint16_t expected = reference_crc16(data, len);
+            uint16_t crc = acp_crc16_update(ACP_CRC16_INIT, data, len);
+            if (crc != expected)
+            {
+                printf("✗ %s mismatch: len=%zu align=%zu\n", acp_crc16_kernel_name(kernel), len, align);
+                ok = 0;
+                break;
+            }
+
+            /* Arbitrary running state must be carried into the first block */
+            acp_crc16_set_kernel(ACP_CRC16_KERNEL_TABLE);
+            uint16_t seeded = acp_crc16_update(seed, data, len);
+            acp_crc16_set_kernel(kernel);
+            if (acp_crc16_update(seed, data, len) != seeded)
+            {
+                printf("✗ %s seeded mismatch: len=%zu seed=0x%04X\n", acp_crc16_kernel_name(kernel), len, seed);
+                ok = 0;
+            }
+        }
+
+        if (ok)
+        {
+            printf("✓ %s: 3000 random lengths, alignments and seeds match\n", acp_crc16_kernel_name(kernel));
+        }
+    }
+
+    /* Masking the CPU features must fall back to the table kernel */
+    acp_cpu_set_feature_mask(0);
+    if (acp_crc16_set_kernel(ACP_CRC16_KERNEL_CLMUL) != ACP_ERR_NOT_IMPLEMENTED ||
+        acp_crc16_set_kernel(ACP_CRC16_KERNEL_AUTO) != ACP_OK ||
+        acp_crc16_get_kernel() != ACP_CRC16_KERNEL_TABLE)
+    {
+        printf("✗ Feature mask did not force the table kernel\n");
+        ok = 0;
+    }
+    else
+    {
+        printf("✓ Table fallback when CPU features are masked\n");
+    }
+    acp_cpu_set_feature_mask(~0u);
+    acp_crc16_set_kernel(ACP_CRC16_KERNEL_AUTO);
+
+    return ok;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP CRC16 Tests\n");
+    printf("===============\n");
+
+    int tests_passed = 0;
+    int total_tests = 3;
+
+    if (test_self_test_vectors())
+        tests_passed++;
+    if (test_random_cross_check())
+        tests_passed++;
+    if (test_kernel_cross_check())
+        tests_passed++;
+
+    printf("\n===============\n");
+    printf("CRC16 Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All CRC16 tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some CRC16 tests FAILED\n");
+    return 1;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file frame_roundtrip_test.c
+ * @brief Frame encode/decode round-trip tests for ACP
+ *
+ * Encodes frames with acp_encode_frame() and decodes them back through both
+ * the copying (acp_decode_frame) and zero-copy (acp_decode_frame_view) paths.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+static void fill_payload(uint8_t *payload, size_t len, uint8_t seed)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        /* Include zero bytes so COBS stuffing is exercised */
+        payload[i] = (uint8_t)((i * 7 + seed) % 251);
+    }
+}
+
+/* Test copying decode path against encoder for a range of payload sizes */
+static int test_copy_roundtrip(void)
+{
+    printf("\nTest 1: acp_decode_frame round-trip\n");
+    printf("===================================\n");
+
+    static const size_t sizes[] = {0, 1, 2, 253, 254, 255, 508, 1000, ACP_MAX_PAYLOAD_SIZE};
+    int failures = 0;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        uint8_t payload[ACP_MAX_PAYLOAD_SIZE];
+        uint8_t encoded[ACP_MAX_FRAME_SIZE + 64];
+        size_t encoded_len = sizeof(encoded);
+        fill_payload(payload, sizes[s], (uint8_t)s);
+
+        acp_result_t result = acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizes[s],
+                                               NULL, encoded, &encoded_len);
+        if (result != ACP_OK)
+        {
+            printf("✗ Encode failed for %zu bytes: %d\n", sizes[s], result);
+            failures++;
+            continue;
+        }
+
+        acp_frame_t frame;
+        size_t consumed = 0;
+        result = acp_decode_frame(encoded, encoded_len, &frame, &consumed, NULL);
+        if (result != ACP_OK || consumed != encoded_len || frame.length != sizes[s] ||
+            memcmp(frame.payload, payload, sizes[s]) != 0)
+        {
+            printf("✗ Round-trip mismatch for %zu bytes (result %d)\n", sizes[s], result);
+            failures++;
+            continue;
+        }
+
+        printf("✓ %zu-byte payload round-trips (%zu bytes on wire)\n", sizes[s], encoded_len);
+    }
+
+    return failures == 0;
+}
+
+/* Test that the view path points into the caller's decode buffer */
+static int test_view_roundtrip(void)
+{
+    printf("\nTest 2: acp_decode_frame_view zero-copy decode\n");
+    printf("==============================================\n");
+
+    uint8_t payload[300];
+    uint8_t encoded[ACP_MAX_FRAME_SIZE + 64];
+    size_t encoded_len = sizeof(encoded);
+    fill_payload(payload, sizeof(payload), 3);
+
+    acp_result_t result = acp_encode_frame(ACP_FRAME_TYPE_SYSTEM, 0, payload, sizeof(payload),
+                                           NULL, encoded, &encoded_len);
+    if (result != ACP_OK)
+    {
+        printf("✗ Encode failed: %d\n", result);
+        return 0;
+    }
+
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+    acp_frame_view_t view;
+    size_t consumed = 0;
+    result = acp_decode_frame_view(encoded, encoded_len, decode_buf, sizeof(decode_buf),
+                                   &view, &consumed, NULL);
+    if (result != ACP_OK)
+    {
+        printf("✗ View decode failed: %d\n", result);
+        return 0;
+    }
+
+    if (view.payload < decode_buf || view.payload + view.length > decode_buf + sizeof(decode_buf))
+    {
+        printf("✗ View payload does not point into the decode buffer\n");
+        return 0;
+    }
+    if (view.type != ACP_FRAME_TYPE_SYSTEM || view.length != sizeof(payload) ||
+        memcmp(view.payload, payload, sizeof(payload)) != 0 || view.hmac_tag != NULL ||
+        consumed != encoded_len)
+    {
+        printf("✗ View contents mismatch\n");
+        return 0;
+    }
+    printf("✓ View payload references decode buffer at offset %ld\n",
+           (long)(view.payload - decode_buf));
+
+    /* A decode buffer that cannot hold the frame must be rejected */
+    result = acp_decode_frame_view(encoded, encoded_len, decode_buf, 16, &view, &consumed, NULL);
+    if (result != ACP_ERR_BUFFER_TOO_SMALL)
+    {
+        printf("✗ Undersized decode buffer not rejected: %d\n", result);
+        return 0;
+    }
+    printf("✓ Undersized decode buffer rejected\n");
+
+    return 1;
+}
+
+/* Test authenticated frames through the view path */
+static int test_authenticated_view(void)
+{
+    printf("\nTest 3: Authenticated frame view\n");
+    printf("================================\n");
+
+    acp_session_t tx_session;
+    acp_session_t rx_session;
+    if (acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234) != ACP_OK ||
+        acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234) != ACP_OK)
+    {
+        printf("✗ Session init failed\n");
+        return 0;
+    }
+
+    uint8_t payload[] = {0x10, 0x00, 0x20, 0x00, 0x30};
+    uint8_t encoded[128];
+    size_t encoded_len = sizeof(encoded);
+    acp_result_t result = acp_encode_frame(ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED,
+                                           payload, sizeof(payload), &tx_session,
+                                           encoded, &encoded_len);
+    if (result != ACP_OK)
+    {
+        printf("✗ Authenticated encode failed: %d\n", result);
+        return 0;
+    }
+
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+    acp_frame_view_t view;
+    size_t consumed = 0;
+    result = acp_decode_frame_view(encoded, encoded_len, decode_buf, sizeof(decode_buf),
+                                   &view, &consumed, &rx_session);
+    if (result != ACP_OK || view.sequence != 1 || view.hmac_tag != encoded + encoded_len - ACP_HMAC_TAG_LEN ||
+        memcmp(view.payload, payload, sizeof(payload)) != 0)
+    {
+        printf("✗ Authenticated view decode failed: %d\n", result);
+        return 0;
+    }
+    printf("✓ Authenticated view decoded (seq=%u)\n", view.sequence);
+
+    /* Replaying the same frame must be rejected */
+    result = acp_decode_frame_view(encoded, encoded_len, decode_buf, sizeof(decode_buf),
+                                   &view, &consumed, &rx_session);
+    if (result != ACP_ERR_REPLAY)
+    {
+        printf("✗ Replay not rejected: %d\n", result);
+        return 0;
+    }
+    printf("✓ Replayed frame rejected\n");
+
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Frame Round-Trip Tests\n");
+    printf("==========================\n");
+
+    if (acp_init() != ACP_OK)
+    {
+        printf("Failed to initialize ACP\n");
+        return 1;
+    }
+
+    int tests_passed = 0;
+    int total_tests = 3;
+
+    if (test_copy_roundtrip())
+        tests_passed++;
+    if (test_view_roundtrip())
+        tests_passed++;
+    if (test_authenticated_view())
+        tests_passed++;
+
+    acp_cleanup();
+
+    printf("\n==========================\n");
+    printf("Frame Round-Trip Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All frame round-trip tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some frame round-trip tests FAILED\n");
+    return 1;
+}
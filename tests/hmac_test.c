@@ -7,6 +7,7 @@
 #include <string.h>
 #include <assert.h>
 #include "acp_protocol.h"
+#include "acp_cpu.h"
 
 static void print_hex(const char *label, const uint8_t *data, size_t len)
 {
@@ -183,6 +184,228 @@ static void test_vector_5(void)
     printf("  ✓ Test Vector 5 PASSED (consistency verified)\n");
 }
 
+/**
+ * @brief Incremental and midstate HMAC must match the one-shot HMAC
+ */
+static void test_incremental_and_midstate(void)
+{
+    printf("Incremental HMAC and precomputed midstates...\n");
+
+    uint8_t data[600];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 37u + 11u);
+    }
+
+    /* Short, block-sized, and hashed (longer than one block) keys */
+    static const size_t key_lens[] = {4, 32, 64, 65, 131};
+    uint8_t key[131];
+    for (size_t i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (uint8_t)(0xA5 ^ i);
+    }
+
+    for (size_t k = 0; k < sizeof(key_lens) / sizeof(key_lens[0]); k++)
+    {
+        acp_hmac_midstate_t midstate;
+        acp_hmac_midstate_init(&midstate, key, key_lens[k]);
+
+        for (size_t len = 0; len <= sizeof(data); len += 23)
+        {
+            uint8_t expected[32];
+            acp_hmac_sha256(key, key_lens[k], data, len, expected);
+
+            /* Update split into uneven pieces across block boundaries */
+            acp_hmac_ctx_t ctx;
+            uint8_t full[32];
+            acp_hmac_init(&ctx, key, key_lens[k]);
+            for (size_t pos = 0, step = 1; pos < len; pos += step, step = step * 3 + 1)
+            {
+                acp_hmac_update(&ctx, data + pos, (pos + step <= len) ? step : len - pos);
+            }
+            acp_hmac_final(&ctx, full, 0);
+            assert(memcmp(full, expected, 32) == 0);
+
+            /* Context from midstates, truncated output */
+            uint8_t tag[ACP_HMAC_TAG_LEN + 1];
+            tag[ACP_HMAC_TAG_LEN] = 0xEE;
+            acp_hmac_init_midstate(&ctx, &midstate);
+            acp_hmac_update(&ctx, data, len);
+            acp_hmac_final(&ctx, tag, 1);
+            assert(memcmp(tag, expected, ACP_HMAC_TAG_LEN) == 0);
+            assert(tag[ACP_HMAC_TAG_LEN] == 0xEE); /* Truncated output stays in bounds */
+
+            acp_hmac_sha256_midstate(&midstate, data, len, tag);
+            assert(memcmp(tag, expected, ACP_HMAC_TAG_LEN) == 0);
+        }
+    }
+    printf("  ✓ Incremental and midstate tags match one-shot HMAC\n");
+
+    /* Session midstates track the key across rotation */
+    acp_session_t session;
+    acp_hmac_midstate_t expected;
+    uint8_t session_key[ACP_KEY_SIZE];
+    uint8_t new_key[ACP_KEY_SIZE];
+    memset(session_key, 0x3C, sizeof(session_key));
+    memset(new_key, 0xC3, sizeof(new_key));
+
+    acp_result_t result = acp_session_init(&session, 1, session_key, sizeof(session_key), 42);
+    assert(result == ACP_OK);
+    acp_hmac_midstate_init(&expected, session_key, sizeof(session_key));
+    assert(memcmp(&session.hmac, &expected, sizeof(expected)) == 0);
+
+    result = acp_session_rotate(&session, new_key, sizeof(new_key), 43);
+    assert(result == ACP_OK);
+    acp_hmac_midstate_init(&expected, new_key, sizeof(new_key));
+    assert(memcmp(&session.hmac, &expected, sizeof(expected)) == 0);
+    (void)result; /* Suppress unused warning in release builds */
+    printf("  ✓ Session midstates follow acp_session_rotate()\n");
+}
+
+/**
+ * @brief Every SHA-256 kernel must match NIST vectors and the scalar kernel
+ */
+static void test_sha256_kernels(void)
+{
+    printf("SHA-256 kernel cross-check...\n");
+
+    static const uint8_t two_block_msg[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    static const uint8_t two_block_hash[32] = {
+        0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8,
+        0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+        0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
+        0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1};
+
+    static uint8_t data[4096 + 64];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+
+    /* Reference digests from the scalar kernel */
+    static uint8_t expected[64][32];
+    int result = acp_sha256_set_kernel(ACP_SHA256_KERNEL_SCALAR);
+    assert(result == ACP_OK);
+    for (size_t t = 0; t < 64; t++)
+    {
+        size_t len = (t < 32) ? t * 9 : (t * 131u) % 4096;
+        acp_sha256(data + (t % 61), len, expected[t]);
+    }
+
+    for (int k = ACP_SHA256_KERNEL_SCALAR; k < ACP_SHA256_KERNEL_COUNT; k++)
+    {
+        acp_sha256_kernel_t kernel = (acp_sha256_kernel_t)k;
+        if (acp_sha256_set_kernel(kernel) != ACP_OK)
+        {
+            printf("  - %s: not available, skipped\n", acp_sha256_kernel_name(kernel));
+            continue;
+        }
+
+        uint8_t hash[32];
+        acp_sha256(two_block_msg, sizeof(two_block_msg) - 1, hash);
+        assert(memcmp(hash, two_block_hash, 32) == 0);
+        result = acp_sha256_self_test() | acp_hmac_self_test();
+        assert(result == 0);
+
+        for (size_t t = 0; t < 64; t++)
+        {
+            size_t len = (t < 32) ? t * 9 : (t * 131u) % 4096;
+            acp_sha256(data + (t % 61), len, hash);
+            assert(memcmp(hash, expected[t], 32) == 0);
+        }
+        printf("  ✓ %s matches NIST vectors and scalar kernel\n", acp_sha256_kernel_name(kernel));
+    }
+
+    result = acp_sha256_set_kernel(ACP_SHA256_KERNEL_AUTO);
+    assert(result == ACP_OK);
+    (void)result; /* Suppress unused warnings in release builds */
+    (void)two_block_hash;
+    printf("  auto-selected kernel: %s\n", acp_sha256_kernel_name(acp_sha256_get_kernel()));
+}
+
+/**
+ * @brief Batch verification must agree with per-frame HMAC on every path
+ */
+static void test_verify_batch(void)
+{
+    printf("Batch HMAC verification...\n");
+
+    static uint8_t data[ACP_HMAC_BATCH_MAX][300];
+    static uint8_t tags[ACP_HMAC_BATCH_MAX][ACP_HMAC_TAG_LEN];
+    acp_hmac_midstate_t keys[3];
+    acp_hmac_verify_item_t items[ACP_HMAC_BATCH_MAX];
+    uint64_t expected_mask = 0;
+
+    for (size_t k = 0; k < 3; k++)
+    {
+        uint8_t key[ACP_KEY_SIZE];
+        memset(key, (int)(0x11 * (k + 1)), sizeof(key));
+        acp_hmac_midstate_init(&keys[k], key, sizeof(key));
+    }
+
+    /* Mixed keys and lengths spanning one to six blocks; every third tag corrupted */
+    for (size_t i = 0; i < ACP_HMAC_BATCH_MAX; i++)
+    {
+        size_t len = (i * 37u) % sizeof(data[i]);
+        for (size_t j = 0; j < len; j++)
+        {
+            data[i][j] = (uint8_t)(i * 7u + j);
+        }
+        acp_hmac_sha256_midstate(&keys[i % 3], data[i], len, tags[i]);
+        if (i % 3 == 1)
+        {
+            tags[i][i % ACP_HMAC_TAG_LEN] ^= 0x01;
+        }
+        else
+        {
+            expected_mask |= (uint64_t)1 << i;
+        }
+
+        items[i].key = &keys[i % 3];
+        items[i].data = data[i];
+        items[i].data_len = len;
+        items[i].tag = tags[i];
+    }
+
+    /* Each kernel with and without the AVX2 multi-buffer engine */
+    for (int run = 0; run < 2 * (ACP_SHA256_KERNEL_COUNT - 1); run++)
+    {
+        acp_sha256_kernel_t kernel = (acp_sha256_kernel_t)(ACP_SHA256_KERNEL_SCALAR + run / 2);
+        int serial = run % 2;
+        acp_cpu_set_feature_mask(serial ? ~(uint32_t)ACP_CPU_AVX2 : ~0u);
+        if (acp_sha256_set_kernel(kernel) != ACP_OK)
+        {
+            continue;
+        }
+
+        static const size_t counts[] = {0, 1, 5, 8, 9, 17, ACP_HMAC_BATCH_MAX};
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+        {
+            uint64_t mask = ~(uint64_t)0;
+            int result = acp_hmac_verify_batch(items, counts[c], &mask);
+            uint64_t want = (counts[c] == 64) ? expected_mask : expected_mask & (((uint64_t)1 << counts[c]) - 1);
+            assert(result == ACP_OK);
+            assert(mask == want);
+            (void)result;
+            (void)want;
+        }
+        printf("  ✓ %s%s: batch mask matches per-frame verification\n",
+               acp_sha256_kernel_name(kernel), serial ? " (AVX2 masked)" : "");
+    }
+    acp_cpu_set_feature_mask(~0u);
+    acp_sha256_set_kernel(ACP_SHA256_KERNEL_AUTO);
+
+    /* Malformed items fail individually; oversized batches are rejected */
+    uint64_t mask = 0;
+    items[0].tag = NULL;
+    int result = acp_hmac_verify_batch(items, 4, &mask);
+    assert(result == ACP_OK && mask == (expected_mask & 0xE));
+    result = acp_hmac_verify_batch(items, ACP_HMAC_BATCH_MAX + 1, &mask);
+    assert(result == ACP_ERR_INVALID_PARAM);
+    (void)result;
+    printf("  ✓ Malformed items and oversized batches handled\n");
+}
+
 /**
  * @brief Validate 16-byte truncation properties
  */
@@ -254,6 +477,15 @@ int main(void)
     test_vector_5();
     printf("\n");
 
+    test_incremental_and_midstate();
+    printf("\n");
+
+    test_sha256_kernels();
+    printf("\n");
+
+    test_verify_batch();
+    printf("\n");
+
     validate_truncation_properties();
     printf("\n");
 
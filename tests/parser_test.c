@@ -0,0 +1,380 @@
+/**
+ * @file parser_test.c
+ * @brief Push parser tests for ACP
+ *
+ * Pushes a link stream of every frame type, with idle fill between frames,
+ * through acp_parser_push() in chunks of various sizes and checks the frame
+ * handler sees every frame once and in order. Frames with a bad tag, a bad
+ * CRC or cut short reach the error handler at the right stream offset
+ * without disturbing the frames around them.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+
+#define MAX_EVENTS 16
+#define IDLE_FILL 2
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+/* A link carrying every frame type, commands authenticated */
+typedef struct
+{
+    uint8_t type;
+    uint8_t flags;
+    size_t length;
+} frame_spec_t;
+
+static const frame_spec_t link_frames[] = {
+    {ACP_FRAME_TYPE_TELEMETRY, 0, 0},
+    {ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, 5},
+    {ACP_FRAME_TYPE_SYSTEM, 0, 254},
+    {ACP_FRAME_TYPE_TELEMETRY, ACP_FLAG_AUTHENTICATED, 255},
+    {ACP_FRAME_TYPE_TELEMETRY, 0, 700},
+    {ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, ACP_MAX_PAYLOAD_SIZE}};
+
+#define LINK_FRAMES ((int)(sizeof(link_frames) / sizeof(link_frames[0])))
+
+static uint8_t stream[LINK_FRAMES * (ACP_MAX_FRAME_SIZE + 64)];
+static size_t frame_starts[LINK_FRAMES];
+static size_t frame_ends[LINK_FRAMES];
+static acp_parser_t parser;
+
+/* What the handlers observed */
+typedef struct
+{
+    int frames;
+    uint8_t types[MAX_EVENTS];
+    size_t lengths[MAX_EVENTS];
+    uint8_t first_bytes[MAX_EVENTS];
+    int errors;
+    acp_result_t error_codes[MAX_EVENTS];
+    uint64_t error_offsets[MAX_EVENTS];
+} events_t;
+
+static void record_frame(void *context, const acp_frame_view_t *view)
+{
+    events_t *events = (events_t *)context;
+    if (events->frames < MAX_EVENTS)
+    {
+        events->types[events->frames] = view->type;
+        events->lengths[events->frames] = view->length;
+        events->first_bytes[events->frames] = view->length ? view->payload[0] : 0;
+    }
+    events->frames++;
+}
+
+static void record_error(void *context, acp_result_t error, uint64_t offset)
+{
+    events_t *events = (events_t *)context;
+    if (events->errors < MAX_EVENTS)
+    {
+        events->error_codes[events->errors] = error;
+        events->error_offsets[events->errors] = offset;
+    }
+    events->errors++;
+}
+
+/* Payload of link frame @p f: starts at f + 1, with a zero every 16 bytes */
+static void link_payload(uint8_t *payload, size_t len, int f)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        payload[i] = (i % 16 == 15) ? 0x00 : (uint8_t)(f + 1 + i);
+    }
+}
+
+/* Encode the link frames with idle fill between them; record where each lies */
+static size_t build_link(acp_session_t *tx_session)
+{
+    size_t len = 0;
+    for (int f = 0; f < LINK_FRAMES; f++)
+    {
+        uint8_t payload[ACP_MAX_PAYLOAD_SIZE];
+        link_payload(payload, link_frames[f].length, f);
+
+        if (f > 0)
+        {
+            memset(stream + len, ACP_COBS_DELIMITER, IDLE_FILL);
+            len += IDLE_FILL;
+        }
+        size_t out_len = sizeof(stream) - len;
+        if (acp_encode_frame(link_frames[f].type, link_frames[f].flags, payload, link_frames[f].length,
+                             tx_session, stream + len, &out_len) != ACP_OK)
+        {
+            return 0;
+        }
+        frame_starts[f] = len;
+        len += out_len;
+        frame_ends[f] = len;
+    }
+    return len;
+}
+
+/* Push @p len bytes of the stream in pieces of @p chunk */
+static void push_chunked(size_t len, size_t chunk)
+{
+    for (size_t off = 0; off < len; off += chunk)
+    {
+        size_t chunk_len = (len - off < chunk) ? len - off : chunk;
+        acp_parser_push(&parser, stream + off, chunk_len);
+    }
+}
+
+/* Check the frame handler saw link frame @p f as event @p e */
+static int saw_frame(const events_t *events, int e, int f)
+{
+    uint8_t first = link_frames[f].length ? (uint8_t)(f + 1) : 0;
+    return e < events->frames && events->types[e] == link_frames[f].type &&
+           events->lengths[e] == link_frames[f].length && events->first_bytes[e] == first;
+}
+
+/* Test frames arrive once and in order whatever the chunking */
+static int test_chunked_push(void)
+{
+    printf("\nTest 1: Chunked pushes deliver every frame in order\n");
+    printf("===================================================\n");
+
+    acp_session_t tx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    size_t len = build_link(&tx_session);
+    if (len == 0)
+    {
+        printf("✗ Failed to build stream\n");
+        return 0;
+    }
+
+    static const size_t chunks[] = {1, 2, 3, 7, 64, 255, 1024, sizeof(stream)};
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++)
+    {
+        acp_session_t rx_session;
+        acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+
+        events_t events;
+        memset(&events, 0, sizeof(events));
+        if (acp_parser_init(&parser, &rx_session, record_frame, record_error, &events) != ACP_OK)
+        {
+            printf("✗ Parser init failed\n");
+            return 0;
+        }
+        push_chunked(len, chunks[c]);
+
+        if (events.frames != LINK_FRAMES || events.errors != 0 || parser.offset != len)
+        {
+            printf("✗ %zu-byte chunks: %d frames, %d errors\n", chunks[c], events.frames, events.errors);
+            return 0;
+        }
+        for (int f = 0; f < LINK_FRAMES; f++)
+        {
+            if (!saw_frame(&events, f, f))
+            {
+                printf("✗ %zu-byte chunks: frame %d out of order or corrupted\n", chunks[c], f);
+                return 0;
+            }
+        }
+    }
+
+    printf("✓ %d frames of every type delivered in order for all chunk sizes\n", LINK_FRAMES);
+    return 1;
+}
+
+/* Test damaged frames are reported where they end and the rest still arrive */
+static int test_error_reporting(void)
+{
+    printf("\nTest 2: Damaged frames reach the error handler\n");
+    printf("==============================================\n");
+
+    acp_session_t tx_session, rx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    size_t len = build_link(&tx_session);
+
+    /* Frame 1: last tag byte flipped; frame 2: payload byte flipped */
+    stream[frame_ends[1] - 1] ^= 0x01;
+    stream[frame_starts[2] + 20] ^= 0x5a;
+
+    /* Frame 4: cut mid-block, its tail replaced by the idle fill before frame 5 */
+    size_t cut = frame_starts[4] + 100;
+    memset(stream + cut, ACP_COBS_DELIMITER, frame_starts[5] - cut);
+
+    events_t events;
+    memset(&events, 0, sizeof(events));
+    acp_parser_init(&parser, &rx_session, record_frame, record_error, &events);
+    push_chunked(len, 100);
+
+    if (events.frames != LINK_FRAMES - 3 || events.errors != 3)
+    {
+        printf("✗ %d frames, %d errors\n", events.frames, events.errors);
+        return 0;
+    }
+    if (events.error_codes[0] != ACP_ERR_AUTH_FAILED || events.error_offsets[0] != frame_ends[1] ||
+        events.error_codes[1] != ACP_ERR_CRC_MISMATCH || events.error_offsets[1] != frame_ends[2] ||
+        events.error_codes[2] != ACP_ERR_COBS_DECODE || events.error_offsets[2] != cut + 1)
+    {
+        printf("✗ Errors reported as %d@%llu, %d@%llu, %d@%llu\n",
+               events.error_codes[0], (unsigned long long)events.error_offsets[0],
+               events.error_codes[1], (unsigned long long)events.error_offsets[1],
+               events.error_codes[2], (unsigned long long)events.error_offsets[2]);
+        return 0;
+    }
+    if (!saw_frame(&events, 0, 0) || !saw_frame(&events, 1, 3) || !saw_frame(&events, 2, 5))
+    {
+        printf("✗ Frames around the damaged ones were not delivered\n");
+        return 0;
+    }
+
+    /* Leading garbage and a missing error handler are tolerated */
+    static const uint8_t noise[] = {0x13, 0x37, 0xff, 0x01};
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    len = build_link(&tx_session);
+    memset(&events, 0, sizeof(events));
+    acp_parser_init(&parser, &rx_session, record_frame, NULL, &events);
+    acp_parser_push(&parser, noise, sizeof(noise));
+    acp_parser_push(&parser, stream, len);
+    if (events.frames != LINK_FRAMES)
+    {
+        printf("✗ Leading garbage lost frames: %d\n", events.frames);
+        return 0;
+    }
+
+    printf("✓ Bad tag, CRC and truncation reported at their offsets, other frames delivered\n");
+    return 1;
+}
+
+/* Test reset drops a partial frame and bad arguments are rejected */
+static int test_reset_and_params(void)
+{
+    printf("\nTest 3: Reset and parameter checks\n");
+    printf("==================================\n");
+
+    events_t events;
+    memset(&events, 0, sizeof(events));
+
+    if (acp_parser_init(NULL, NULL, record_frame, NULL, &events) != ACP_ERR_INVALID_PARAM ||
+        acp_parser_init(&parser, NULL, NULL, NULL, &events) != ACP_ERR_INVALID_PARAM)
+    {
+        printf("✗ Bad init arguments not rejected\n");
+        return 0;
+    }
+
+    acp_parser_init(&parser, NULL, record_frame, record_error, &events);
+    if (acp_parser_push(&parser, NULL, 1) != ACP_ERR_INVALID_PARAM ||
+        acp_parser_push(&parser, NULL, 0) != ACP_OK)
+    {
+        printf("✗ Bad push arguments not handled\n");
+        return 0;
+    }
+
+    uint8_t payload[32];
+    uint8_t frame[128];
+    size_t frame_len = sizeof(frame);
+    link_payload(payload, sizeof(payload), 9);
+    acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizeof(payload), NULL, frame, &frame_len);
+
+    /* Half a frame, reset, then the tail alone must not complete anything */
+    acp_parser_push(&parser, frame, frame_len / 2);
+    acp_parser_reset(&parser);
+    acp_parser_push(&parser, frame + frame_len / 2, frame_len - frame_len / 2);
+    size_t frames_after_tail = (size_t)events.frames;
+
+    acp_parser_push(&parser, frame, frame_len);
+    if (frames_after_tail != 0 || events.frames != 1 || parser.offset != 2 * frame_len)
+    {
+        printf("✗ Reset did not discard the partial frame\n");
+        return 0;
+    }
+
+    printf("✓ Bad arguments rejected, reset discards partial frames\n");
+    return 1;
+}
+
+/* Test a truncated authenticated frame does not swallow the frame after it */
+static int test_truncated_auth(void)
+{
+    printf("\nTest 4: Truncated authenticated frame\n");
+    printf("=====================================\n");
+
+    uint8_t data[256];
+    uint8_t payload[40];
+    for (size_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (i % 8 == 7) ? 0x00 : (uint8_t)(i + 1);
+    }
+
+    acp_session_t tx_session, rx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    size_t len = sizeof(data);
+    acp_encode_frame(ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                     &tx_session, data, &len);
+
+    /* Cut at a COBS block boundary, then a telemetry frame whose opening delimiter ends it */
+    size_t cut = 1;
+    for (int block = 0; block < 3; block++)
+    {
+        cut += data[cut];
+    }
+    static const uint8_t telemetry[] = {0x11, 0x22, 0x33};
+    len = sizeof(data) - cut;
+    acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, telemetry, sizeof(telemetry), NULL, data + cut, &len);
+    len += cut;
+
+    events_t events;
+    memset(&events, 0, sizeof(events));
+    acp_parser_init(&parser, &rx_session, record_frame, record_error, &events);
+    acp_parser_push(&parser, data, len);
+
+    if (events.frames != 1 || events.lengths[0] != sizeof(telemetry) || events.first_bytes[0] != telemetry[0])
+    {
+        printf("✗ Telemetry frame after the truncated one not delivered (%d frames)\n", events.frames);
+        return 0;
+    }
+    if (events.errors != 1 || events.error_offsets[0] != cut + 1)
+    {
+        printf("✗ %d errors, first at offset %llu\n", events.errors,
+               (unsigned long long)events.error_offsets[0]);
+        return 0;
+    }
+
+    printf("✓ Truncated frame reported at offset %zu, next frame delivered\n", cut + 1);
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Push Parser Tests\n");
+    printf("=====================\n");
+
+    int tests_passed = 0;
+    int total_tests = 4;
+
+    if (test_chunked_push())
+        tests_passed++;
+    if (test_error_reporting())
+        tests_passed++;
+    if (test_reset_and_params())
+        tests_passed++;
+    if (test_truncated_auth())
+        tests_passed++;
+
+    printf("\n=====================\n");
+    printf("Parser Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All parser tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some parser tests FAILED\n");
+    return 1;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file replay_test.c
+ * @brief Sliding-window replay protection tests for ACP
+ *
+ * Checks that a session with a replay window accepts each sequence number
+ * within the window exactly once in any order, against a brute-force model
+ * of every sequence number seen, and that strict ordering remains the
+ * default. Runs authenticated traffic across the 32-bit sequence boundary
+ * with extended sequence numbers.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+
+#define MODEL_RANGE 20000
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+static uint8_t seen[MODEL_RANGE];
+
+/* Deterministic pseudo-random numbers */
+static uint32_t rng_state = 12345;
+static uint32_t next_random(void)
+{
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+/* Test strict ordering is the default and bad window sizes are rejected */
+static int test_defaults(void)
+{
+    printf("\nTest 1: Strict ordering by default\n");
+    printf("==================================\n");
+
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+
+    if (acp_session_accept_sequence(&session, 5) != ACP_OK ||
+        acp_session_accept_sequence(&session, 3) != ACP_ERR_REPLAY ||
+        acp_session_accept_sequence(&session, 5) != ACP_ERR_REPLAY ||
+        acp_session_accept_sequence(&session, 0) != ACP_ERR_REPLAY ||
+        acp_session_accept_sequence(&session, 6) != ACP_OK)
+    {
+        printf("✗ Default session is not strictly increasing\n");
+        return 0;
+    }
+
+    static const uint16_t bad[] = {1, 32, 63, 65, 100, 1088, 2048};
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        if (acp_session_set_replay_window(&session, bad[i]) != ACP_ERR_INVALID_PARAM)
+        {
+            printf("✗ Window of %u bits not rejected\n", bad[i]);
+            return 0;
+        }
+    }
+    if (acp_session_set_replay_window(NULL, 64) != ACP_ERR_INVALID_PARAM ||
+        acp_session_set_replay_window(&session, ACP_REPLAY_WINDOW_MIN) != ACP_OK ||
+        acp_session_set_replay_window(&session, ACP_REPLAY_WINDOW_MAX) != ACP_OK ||
+        acp_session_set_replay_window(&session, 0) != ACP_OK)
+    {
+        printf("✗ Valid window sizes not accepted\n");
+        return 0;
+    }
+
+    printf("✓ Reordered and repeated sequences rejected, window sizes validated\n");
+    return 1;
+}
+
+/* Test the window edges, repeats and a jump past the whole window */
+static int test_window_edges(void)
+{
+    printf("\nTest 2: Window edges\n");
+    printf("====================\n");
+
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_accept_sequence(&session, 100);
+    acp_session_set_replay_window(&session, 64);
+
+    /* The highest sequence stays accepted across the window change */
+    if (acp_session_accept_sequence(&session, 100) != ACP_ERR_REPLAY)
+    {
+        printf("✗ Highest sequence forgotten when enabling the window\n");
+        return 0;
+    }
+
+    /* 37..99 are within 64 of 100; 36 is not */
+    if (acp_session_accept_sequence(&session, 37) != ACP_OK ||
+        acp_session_accept_sequence(&session, 99) != ACP_OK ||
+        acp_session_accept_sequence(&session, 36) != ACP_ERR_REPLAY ||
+        acp_session_accept_sequence(&session, 37) != ACP_ERR_REPLAY)
+    {
+        printf("✗ Window edges wrong around 100\n");
+        return 0;
+    }
+
+    /* Jump well past the window: everything before it is now too old */
+    if (acp_session_accept_sequence(&session, 1000) != ACP_OK ||
+        acp_session_accept_sequence(&session, 99) != ACP_ERR_REPLAY ||
+        acp_session_accept_sequence(&session, 937) != ACP_OK ||
+        acp_session_accept_sequence(&session, 999) != ACP_OK ||
+        acp_session_accept_sequence(&session, 999) != ACP_ERR_REPLAY ||
+        acp_session_get_last_accepted(&session) != 1000)
+    {
+        printf("✗ Window wrong after a long jump\n");
+        return 0;
+    }
+
+    /* Rotation starts over but keeps the window size */
+    acp_session_rotate(&session, test_key, sizeof(test_key), 0x5678);
+    if (acp_session_accept_sequence(&session, 999) != ACP_OK ||
+        acp_session_accept_sequence(&session, 990) != ACP_OK)
+    {
+        printf("✗ Rotation did not reset the window\n");
+        return 0;
+    }
+
+    printf("✓ Edges, repeats and long jumps handled\n");
+    return 1;
+}
+
+/* Test random arrival orders against a model remembering every sequence */
+static int test_against_model(void)
+{
+    printf("\nTest 3: Random reordering against a model\n");
+    printf("=========================================\n");
+
+    static const uint16_t windows[] = {64, 128, 512, 1024};
+    size_t checked = 0;
+
+    for (size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++)
+    {
+        acp_session_t session;
+        acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+        acp_session_set_replay_window(&session, windows[w]);
+        memset(seen, 0, sizeof(seen));
+        uint32_t top = 0;
+
+        for (int i = 0; i < 50000; i++)
+        {
+            /* Mostly near the top, sometimes far ahead or far behind */
+            uint32_t r = next_random();
+            int64_t candidate;
+            if (r % 100 == 0)
+            {
+                candidate = (int64_t)top + 1 + (int64_t)(next_random() % (3u * windows[w]));
+            }
+            else
+            {
+                candidate = (int64_t)top + 8 - (int64_t)(next_random() % (windows[w] + 64u));
+            }
+            if (candidate < 0 || candidate >= MODEL_RANGE)
+            {
+                continue;
+            }
+            uint32_t sequence = (uint32_t)candidate;
+
+            int expect_ok = sequence != 0 && !seen[sequence] &&
+                            (sequence > top || top - sequence < windows[w]);
+            acp_result_t result = acp_session_accept_sequence(&session, sequence);
+            if ((result == ACP_OK) != expect_ok)
+            {
+                printf("✗ Window %u: sequence %u with top %u gave %d\n", windows[w], sequence, top, result);
+                return 0;
+            }
+            if (expect_ok)
+            {
+                seen[sequence] = 1;
+                if (sequence > top)
+                {
+                    top = sequence;
+                }
+            }
+            checked++;
+        }
+    }
+
+    printf("✓ %zu sequence numbers agree with the model\n", checked);
+    return 1;
+}
+
+/* Test reordered authenticated frames decode once each */
+static int test_reordered_frames(void)
+{
+    printf("\nTest 4: Reordered frames through acp_decode_frame\n");
+    printf("=================================================\n");
+
+    enum
+    {
+        FRAMES = 8
+    };
+    static uint8_t encoded[FRAMES][128];
+    size_t lengths[FRAMES];
+
+    acp_session_t tx_session, rx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+
+    for (int f = 0; f < FRAMES; f++)
+    {
+        uint8_t payload[4] = {(uint8_t)f, 1, 2, 3};
+        lengths[f] = sizeof(encoded[f]);
+        acp_encode_frame(ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                         &tx_session, encoded[f], &lengths[f]);
+    }
+
+    /* Arrival order with frames overtaken by later ones */
+    static const int order[FRAMES] = {1, 0, 3, 2, 7, 4, 6, 5};
+
+    acp_session_t strict_session = rx_session;
+    int strict_accepted = 0;
+    acp_session_set_replay_window(&rx_session, 64);
+    for (int i = 0; i < FRAMES; i++)
+    {
+        acp_frame_t frame;
+        size_t consumed;
+        int f = order[i];
+        if (acp_decode_frame(encoded[f], lengths[f], &frame, &consumed, &strict_session) == ACP_OK)
+        {
+            strict_accepted++;
+        }
+        if (acp_decode_frame(encoded[f], lengths[f], &frame, &consumed, &rx_session) != ACP_OK ||
+            frame.payload[0] != (uint8_t)f)
+        {
+            printf("✗ Frame %d rejected with a window\n", f);
+            return 0;
+        }
+    }
+
+    for (int f = 0; f < FRAMES; f++)
+    {
+        acp_frame_t frame;
+        size_t consumed;
+        if (acp_decode_frame(encoded[f], lengths[f], &frame, &consumed, &rx_session) != ACP_ERR_REPLAY)
+        {
+            printf("✗ Replay of frame %d accepted\n", f);
+            return 0;
+        }
+    }
+
+    printf("✓ All %d frames accepted once (strict ordering accepts %d)\n", FRAMES, strict_accepted);
+    return 1;
+}
+
+/* Test frames keep flowing across the 32-bit boundary with extended sequence numbers */
+static int test_extended_sequence(void)
+{
+    printf("\nTest 5: Extended sequence numbers across 2^32\n");
+    printf("=============================================\n");
+
+    enum
+    {
+        FRAMES = 32
+    };
+    static uint8_t encoded[FRAMES][128];
+    size_t lengths[FRAMES];
+    const uint64_t start = 0xFFFFFFF0ull;
+    uint8_t payload[4] = {1, 2, 3, 4};
+
+    /* Without extended sequence numbers the session expires instead of wrapping */
+    acp_session_t tx_session, rx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_set_next_sequence(&tx_session, UINT32_MAX);
+    size_t len = sizeof(encoded[0]);
+    if (acp_encode_frame(ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                         &tx_session, encoded[0], &len) != ACP_OK)
+    {
+        printf("✗ Last 32-bit sequence number not usable\n");
+        return 0;
+    }
+    len = sizeof(encoded[0]);
+    if (acp_encode_frame(ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                         &tx_session, encoded[0], &len) != ACP_ERR_SESSION_EXPIRED)
+    {
+        printf("✗ 32-bit session wrapped instead of expiring\n");
+        return 0;
+    }
+
+    /* Both ends well into the session, just short of the boundary */
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_set_extended_sequence(&tx_session, true);
+    acp_session_set_extended_sequence(&rx_session, true);
+    acp_session_set_replay_window(&rx_session, 64);
+    acp_session_set_next_sequence(&tx_session, start);
+    acp_session_set_last_accepted(&rx_session, start - 1);
+
+    for (int f = 0; f < FRAMES; f++)
+    {
+        payload[0] = (uint8_t)f;
+        lengths[f] = sizeof(encoded[f]);
+        if (acp_encode_frame(ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                             &tx_session, encoded[f], &lengths[f]) != ACP_OK)
+        {
+            printf("✗ Encode of frame %d failed\n", f);
+            return 0;
+        }
+    }
+
+    /* A receiver without extended sequence numbers cannot authenticate past the boundary */
+    acp_session_t legacy_session;
+    acp_session_init(&legacy_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_frame_t frame;
+    size_t consumed;
+    if (acp_decode_frame(encoded[FRAMES - 1], lengths[FRAMES - 1], &frame, &consumed, &legacy_session) !=
+        ACP_ERR_AUTH_FAILED)
+    {
+        printf("✗ High sequence bits not covered by the HMAC\n");
+        return 0;
+    }
+
+    /* Deliver pairs swapped so reordering straddles the boundary */
+    for (int i = 0; i < FRAMES; i++)
+    {
+        int f = i ^ 1;
+        if (acp_decode_frame(encoded[f], lengths[f], &frame, &consumed, &rx_session) != ACP_OK ||
+            frame.payload[0] != (uint8_t)f || frame.sequence != (uint32_t)(start + (uint64_t)f))
+        {
+            printf("✗ Frame %d rejected across the boundary\n", f);
+            return 0;
+        }
+    }
+    if (acp_session_get_last_accepted(&rx_session) != start + FRAMES - 1 ||
+        acp_session_get_next_sequence(&tx_session) != start + FRAMES)
+    {
+        printf("✗ Counters did not carry into the high bits\n");
+        return 0;
+    }
+
+    /* Replays from either side of the boundary are replays, not forgeries */
+    if (acp_decode_frame(encoded[0], lengths[0], &frame, &consumed, &rx_session) != ACP_ERR_REPLAY ||
+        acp_decode_frame(encoded[FRAMES - 1], lengths[FRAMES - 1], &frame, &consumed, &rx_session) !=
+            ACP_ERR_REPLAY)
+    {
+        printf("✗ Replay across the boundary not reported as a replay\n");
+        return 0;
+    }
+
+    printf("✓ %d frames carried from sequence 0x%llx into the next 2^32 block\n",
+           FRAMES, (unsigned long long)start);
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Replay Window Tests\n");
+    printf("=======================\n");
+
+    int tests_passed = 0;
+    int total_tests = 5;
+
+    if (test_defaults())
+        tests_passed++;
+    if (test_window_edges())
+        tests_passed++;
+    if (test_against_model())
+        tests_passed++;
+    if (test_reordered_frames())
+        tests_passed++;
+    if (test_extended_sequence())
+        tests_passed++;
+
+    printf("\n=======================\n");
+    printf("Replay Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All replay tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some replay tests FAILED\n");
+    return 1;
+}
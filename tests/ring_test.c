@@ -0,0 +1,422 @@
+/**
+ * @file ring_test.c
+ * @brief SPSC byte ring tests for ACP
+ *
+ * Checks byte order and capacity across many wraparounds, the in-place
+ * region interface and the cache-line layout, then runs a producer and a
+ * consumer on separate threads, first with raw bytes and then with an
+ * encoded frame stream drained by the incremental decoder.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "acp_protocol.h"
+#include "acp_ring.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#define RING_TEST_THREADS 1
+#endif
+
+#define RING_SIZE 4096
+#define STRESS_BYTES (8u * 1024u * 1024u)
+#define PIPELINE_FRAMES 2000
+
+static uint8_t ring_storage[RING_SIZE];
+
+/* Byte n of the reference stream */
+static uint8_t stream_byte(size_t n)
+{
+    return (uint8_t)((n * 2654435761u) >> 13);
+}
+
+/* Test ordering and capacity across repeated wraparound */
+static int test_wraparound(void)
+{
+    printf("\nTest 1: Byte order across wraparound\n");
+    printf("====================================\n");
+
+    acp_ring_t ring;
+    if (acp_ring_init(&ring, ring_storage, 1000) != ACP_ERR_INVALID_PARAM ||
+        acp_ring_init(&ring, NULL, RING_SIZE) != ACP_ERR_INVALID_PARAM ||
+        acp_ring_init(&ring, ring_storage, RING_SIZE) != ACP_OK)
+    {
+        printf("✗ Init validation failed\n");
+        return 0;
+    }
+
+    uint8_t chunk[RING_SIZE + 16];
+    size_t written = 0, read = 0;
+    for (size_t round = 0; round < 5000; round++)
+    {
+        size_t want = (round * 37) % (RING_SIZE / 3) + 1;
+        for (size_t i = 0; i < want; i++)
+        {
+            chunk[i] = stream_byte(written + i);
+        }
+        written += acp_ring_write(&ring, chunk, want);
+
+        size_t got = acp_ring_read(&ring, chunk, (round * 53) % (RING_SIZE / 3) + 1);
+        for (size_t i = 0; i < got; i++)
+        {
+            if (chunk[i] != stream_byte(read + i))
+            {
+                printf("✗ Byte %zu out of order\n", read + i);
+                return 0;
+            }
+        }
+        read += got;
+        if (acp_ring_used(&ring) != written - read)
+        {
+            printf("✗ Used count %zu, expected %zu\n", acp_ring_used(&ring), written - read);
+            return 0;
+        }
+    }
+
+    /* Full ring takes exactly its size; empty ring yields nothing */
+    memset(chunk, 0xA5, sizeof(chunk));
+    size_t room = RING_SIZE - acp_ring_used(&ring);
+    if (acp_ring_write(&ring, chunk, sizeof(chunk)) != room || acp_ring_write(&ring, chunk, 1) != 0)
+    {
+        printf("✗ Full ring accepted the wrong number of bytes\n");
+        return 0;
+    }
+    while (acp_ring_read(&ring, chunk, sizeof(chunk)) > 0)
+    {
+    }
+    if (acp_ring_used(&ring) != 0 || acp_ring_read(&ring, chunk, 1) != 0)
+    {
+        printf("✗ Drained ring not empty\n");
+        return 0;
+    }
+
+    printf("✓ %zu bytes through a %d-byte ring in order\n", read, RING_SIZE);
+    return 1;
+}
+
+/* Test the in-place region interface */
+static int test_regions(void)
+{
+    printf("\nTest 2: In-place regions\n");
+    printf("========================\n");
+
+    acp_ring_t ring;
+    acp_ring_init(&ring, ring_storage, RING_SIZE);
+
+    /* Move the indices close to the end of storage */
+    acp_ring_regions_t regions;
+    acp_ring_write_regions(&ring, &regions);
+    acp_ring_produce(&ring, RING_SIZE - 100);
+    acp_ring_read_regions(&ring, &regions);
+    acp_ring_consume(&ring, RING_SIZE - 100);
+
+    size_t free_bytes = acp_ring_write_regions(&ring, &regions);
+    if (free_bytes != RING_SIZE || regions.first_len != 100 || regions.second_len != RING_SIZE - 100 ||
+        regions.first != ring_storage + RING_SIZE - 100 || regions.second != ring_storage)
+    {
+        printf("✗ Free space not split at the end of storage\n");
+        return 0;
+    }
+
+    /* Produce 300 bytes in place across the seam */
+    for (size_t i = 0; i < 300; i++)
+    {
+        uint8_t *dst = (i < regions.first_len) ? regions.first + i : regions.second + (i - regions.first_len);
+        *dst = stream_byte(i);
+    }
+    acp_ring_produce(&ring, 300);
+
+    size_t used = acp_ring_read_regions(&ring, &regions);
+    if (used != 300 || regions.first_len != 100 || regions.second_len != 200)
+    {
+        printf("✗ Readable bytes not reported as two regions\n");
+        return 0;
+    }
+    for (size_t i = 0; i < 300; i++)
+    {
+        uint8_t b = (i < regions.first_len) ? regions.first[i] : regions.second[i - regions.first_len];
+        if (b != stream_byte(i))
+        {
+            printf("✗ Region byte %zu wrong\n", i);
+            return 0;
+        }
+    }
+    acp_ring_consume(&ring, 150);
+    used = acp_ring_read_regions(&ring, &regions);
+    if (used != 150 || regions.second_len != 0 || regions.first[0] != stream_byte(150))
+    {
+        printf("✗ Partial consume left the wrong bytes\n");
+        return 0;
+    }
+
+    printf("✓ Regions split at the seam and track produce/consume\n");
+    return 1;
+}
+
+/* Test producer and consumer indices sit on different cache lines */
+static int test_layout(void)
+{
+    printf("\nTest 3: Cache-line layout\n");
+    printf("=========================\n");
+
+    size_t head = offsetof(acp_ring_t, head);
+    size_t tail = offsetof(acp_ring_t, tail);
+    size_t buffer = offsetof(acp_ring_t, buffer);
+    if (tail - head < ACP_CACHE_LINE_SIZE || buffer - tail < ACP_CACHE_LINE_SIZE)
+    {
+        printf("✗ Indices share a cache line: head %zu, tail %zu, buffer %zu\n", head, tail, buffer);
+        return 0;
+    }
+
+    printf("✓ head at %zu, tail at %zu, storage pointer at %zu\n", head, tail, buffer);
+    return 1;
+}
+
+#ifdef RING_TEST_THREADS
+
+static acp_ring_t shared_ring;
+
+/* Producer: stream bytes in uneven chunks */
+static void *byte_producer(void *arg)
+{
+    (void)arg;
+    uint8_t chunk[777];
+    size_t sent = 0;
+    while (sent < STRESS_BYTES)
+    {
+        size_t want = (sent % sizeof(chunk)) + 1;
+        if (want > STRESS_BYTES - sent)
+        {
+            want = STRESS_BYTES - sent;
+        }
+        for (size_t i = 0; i < want; i++)
+        {
+            chunk[i] = stream_byte(sent + i);
+        }
+        size_t done = 0;
+        while (done < want)
+        {
+            size_t n = acp_ring_write(&shared_ring, chunk + done, want - done);
+            if (n == 0)
+            {
+                sched_yield();
+            }
+            done += n;
+        }
+        sent += want;
+    }
+    return NULL;
+}
+
+/* Test bytes cross between threads intact */
+static int test_threaded_bytes(void)
+{
+    printf("\nTest 4: Producer and consumer threads\n");
+    printf("=====================================\n");
+
+    acp_ring_init(&shared_ring, ring_storage, RING_SIZE);
+
+    pthread_t producer;
+    if (pthread_create(&producer, NULL, byte_producer, NULL) != 0)
+    {
+        printf("✗ Could not start producer thread\n");
+        return 0;
+    }
+
+    size_t received = 0;
+    int ok = 1;
+    while (received < STRESS_BYTES)
+    {
+        acp_ring_regions_t regions;
+        size_t used = acp_ring_read_regions(&shared_ring, &regions);
+        if (used == 0)
+        {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < used && ok; i++)
+        {
+            uint8_t b = (i < regions.first_len) ? regions.first[i] : regions.second[i - regions.first_len];
+            if (b != stream_byte(received + i))
+            {
+                printf("✗ Byte %zu corrupted\n", received + i);
+                ok = 0;
+            }
+        }
+        acp_ring_consume(&shared_ring, used);
+        received += used;
+        if (!ok)
+        {
+            break;
+        }
+    }
+    pthread_join(producer, NULL);
+    if (!ok)
+    {
+        return 0;
+    }
+
+    printf("✓ %u bytes received in order\n", STRESS_BYTES);
+    return 1;
+}
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+/* Producer: encode frames and push them through the ring */
+static void *frame_producer(void *arg)
+{
+    acp_session_t *session = (acp_session_t *)arg;
+    uint8_t payload[ACP_MAX_PAYLOAD_SIZE];
+    uint8_t encoded[ACP_MAX_FRAME_SIZE + 64];
+
+    for (size_t f = 0; f < PIPELINE_FRAMES; f++)
+    {
+        size_t len = (f * 97) % ACP_MAX_PAYLOAD_SIZE;
+        for (size_t i = 0; i < len; i++)
+        {
+            payload[i] = stream_byte(f + i);
+        }
+        payload[0] = (uint8_t)f;
+
+        size_t encoded_len = sizeof(encoded);
+        uint8_t flags = (f % 3 == 0) ? ACP_FLAG_AUTHENTICATED : 0;
+        acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, flags, payload, len, session, encoded, &encoded_len);
+
+        size_t done = 0;
+        while (done < encoded_len)
+        {
+            size_t n = acp_ring_write(&shared_ring, encoded + done, encoded_len - done);
+            if (n == 0)
+            {
+                sched_yield();
+            }
+            done += n;
+        }
+    }
+    return NULL;
+}
+
+/* Test a frame stream is parsed from the ring while it is being filled */
+static int test_threaded_frames(void)
+{
+    printf("\nTest 5: Pipelined frame decode\n");
+    printf("==============================\n");
+
+    acp_session_t tx_session, rx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_ring_init(&shared_ring, ring_storage, RING_SIZE);
+
+    static uint8_t decoder_buffer[ACP_DECODER_BUFFER_SIZE];
+    acp_decoder_t decoder;
+    acp_decoder_init(&decoder, decoder_buffer, sizeof(decoder_buffer));
+
+    pthread_t producer;
+    if (pthread_create(&producer, NULL, frame_producer, &tx_session) != 0)
+    {
+        printf("✗ Could not start producer thread\n");
+        return 0;
+    }
+
+    /* Parse straight out of the ring storage; the decoder absorbs each region */
+    size_t frames = 0;
+    int ok = 1;
+    while (frames < PIPELINE_FRAMES && ok)
+    {
+        acp_ring_regions_t regions;
+        if (acp_ring_read_regions(&shared_ring, &regions) == 0)
+        {
+            sched_yield();
+            continue;
+        }
+
+        const uint8_t *spans[2] = {regions.first, regions.second};
+        size_t lens[2] = {regions.first_len, regions.second_len};
+        size_t taken = 0;
+        for (int s = 0; s < 2 && ok; s++)
+        {
+            size_t pos = 0;
+            while (pos < lens[s])
+            {
+                acp_frame_view_t view;
+                size_t consumed = 0;
+                acp_result_t result = acp_decoder_decode(&decoder, spans[s] + pos, lens[s] - pos,
+                                                         &consumed, &view, &rx_session);
+                pos += consumed;
+                if (result == ACP_OK)
+                {
+                    if (view.length != (frames * 97) % ACP_MAX_PAYLOAD_SIZE ||
+                        (view.length > 0 && view.payload[0] != (uint8_t)frames))
+                    {
+                        printf("✗ Frame %zu decoded out of order\n", frames);
+                        ok = 0;
+                        break;
+                    }
+                    frames++;
+                }
+                else if (result != ACP_ERR_NEED_MORE_DATA)
+                {
+                    printf("✗ Frame %zu rejected: %d\n", frames, result);
+                    ok = 0;
+                    break;
+                }
+            }
+            taken += pos;
+        }
+        acp_ring_consume(&shared_ring, taken);
+    }
+    pthread_join(producer, NULL);
+    if (!ok)
+    {
+        return 0;
+    }
+
+    printf("✓ %zu frames decoded while the producer was filling the ring\n", frames);
+    return 1;
+}
+
+#endif /* RING_TEST_THREADS */
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Ring Buffer Tests\n");
+    printf("=====================\n");
+
+    int tests_passed = 0;
+    int total_tests = 3;
+
+    if (test_wraparound())
+        tests_passed++;
+    if (test_regions())
+        tests_passed++;
+    if (test_layout())
+        tests_passed++;
+#ifdef RING_TEST_THREADS
+    total_tests += 2;
+    if (test_threaded_bytes())
+        tests_passed++;
+    if (test_threaded_frames())
+        tests_passed++;
+#endif
+
+    printf("\n=====================\n");
+    printf("Ring Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All ring tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some ring tests FAILED\n");
+    return 1;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file scan_test.c
+ * @brief Zero-scan kernel tests for ACP
+ *
+ * Cross-checks every kernel available on the running CPU against the
+ * scalar reference over all zero positions, lengths and alignments that
+ * straddle the vector widths.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_scan.h"
+#include "acp_cpu.h"
+
+#define SCAN_MAX_LEN 300
+#define SCAN_MAX_ALIGN 64
+
+static uint8_t buffer[SCAN_MAX_ALIGN + SCAN_MAX_LEN];
+
+static size_t reference_scan(const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (data[i] == 0)
+        {
+            return i;
+        }
+    }
+    return len;
+}
+
+/* Check one kernel over every length, alignment and single-zero position */
+static int check_kernel(acp_scan_kernel_t kernel)
+{
+    for (size_t align = 0; align < SCAN_MAX_ALIGN; align++)
+    {
+        for (size_t len = 0; len <= SCAN_MAX_LEN; len += (len < 80) ? 1 : 7)
+        {
+            uint8_t *data = buffer + align;
+            for (size_t zero_pos = 0; zero_pos <= len; zero_pos++)
+            {
+                /* 0x80 and 0x01 bytes stress the SWAR borrow logic */
+                for (size_t i = 0; i < len; i++)
+                {
+                    data[i] = (i & 1) ? 0x80 : 0x01;
+                }
+                if (zero_pos < len)
+                {
+                    data[zero_pos] = 0;
+                    /* A second zero further on must not be reported */
+                    if (zero_pos + 3 < len)
+                    {
+                        data[zero_pos + 3] = 0;
+                    }
+                }
+
+                size_t expected = reference_scan(data, len);
+                size_t got = acp_scan_zero(data, len);
+                if (got != expected)
+                {
+                    printf("✗ %s: len=%zu align=%zu zero@%zu returned %zu\n",
+                           acp_scan_kernel_name(kernel), len, align, zero_pos, got);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+/* Test every kernel that this build and CPU support */
+static int test_kernels_match_reference(void)
+{
+    printf("\nTest 1: Kernels match scalar reference\n");
+    printf("======================================\n");
+
+    int failures = 0;
+    for (int k = ACP_SCAN_KERNEL_SCALAR; k < ACP_SCAN_KERNEL_COUNT; k++)
+    {
+        acp_scan_kernel_t kernel = (acp_scan_kernel_t)k;
+        if (acp_scan_set_kernel(kernel) != 0)
+        {
+            printf("- %s not available\n", acp_scan_kernel_name(kernel));
+            continue;
+        }
+        if (check_kernel(kernel))
+        {
+            printf("✓ %s\n", acp_scan_kernel_name(kernel));
+        }
+        else
+        {
+            failures++;
+        }
+    }
+
+    acp_scan_set_kernel(ACP_SCAN_KERNEL_AUTO);
+    return failures == 0;
+}
+
+/* Test automatic selection honours the CPU feature mask */
+static int test_dispatch(void)
+{
+    printf("\nTest 2: Runtime dispatch\n");
+    printf("========================\n");
+
+    acp_scan_set_kernel(ACP_SCAN_KERNEL_AUTO);
+    printf("  auto-selected kernel: %s\n", acp_scan_kernel_name(acp_scan_get_kernel()));
+    if (acp_scan_get_kernel() == ACP_SCAN_KERNEL_AUTO)
+    {
+        printf("✗ Auto selection did not resolve to a kernel\n");
+        return 0;
+    }
+
+    acp_cpu_set_feature_mask(0);
+    acp_scan_set_kernel(ACP_SCAN_KERNEL_AUTO);
+    acp_scan_kernel_t fallback = acp_scan_get_kernel();
+    int avx2_rejected = (acp_scan_set_kernel(ACP_SCAN_KERNEL_AVX2) != 0);
+    acp_cpu_set_feature_mask(~0u);
+    acp_scan_set_kernel(ACP_SCAN_KERNEL_AUTO);
+
+    if (fallback != ACP_SCAN_KERNEL_SWAR || !avx2_rejected)
+    {
+        printf("✗ Masked features not honoured (got %s)\n", acp_scan_kernel_name(fallback));
+        return 0;
+    }
+    printf("✓ Falls back to swar with all features masked\n");
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Zero-Scan Kernel Tests\n");
+    printf("==========================\n");
+
+    int tests_passed = 0;
+    int total_tests = 2;
+
+    if (test_kernels_match_reference())
+        tests_passed++;
+    if (test_dispatch())
+        tests_passed++;
+
+    printf("\n==========================\n");
+    printf("Zero-Scan Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All zero-scan tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some zero-scan tests FAILED\n");
+    return 1;
+}
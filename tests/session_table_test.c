@@ -0,0 +1,502 @@
+/**
+ * @file session_table_test.c
+ * @brief Session table tests for ACP
+ *
+ * Checks argument validation and sizing, then runs a long random sequence
+ * of inserts, lookups and removals on a small table with many collisions
+ * against a brute-force model, fills stripes to their limit, loads a
+ * hundred thousand peers, fills tables sized by
+ * acp_session_table_slots_needed() to the count they were sized for, and
+ * finally has several threads work on one striped table at once.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+#include "acp_session_table.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#define TABLE_TEST_THREADS 1
+#endif
+
+#define POOL_SIZE 64
+#define MODEL_IDS 300
+#define MODEL_OPS 200000
+#define LARGE_PEERS 100000
+#define LARGE_SLOTS 131072
+#define FILL_SLOTS 262144
+#define WORKERS 4
+#define WORKER_IDS 5000
+#define WORKER_STRIPES 16
+
+static acp_session_t pool[POOL_SIZE];
+static acp_session_slot_t small_slots[256];
+static acp_session_slot_t large_slots[LARGE_SLOTS];
+static acp_session_slot_t fill_slots[FILL_SLOTS];
+
+/* Deterministic pseudo-random numbers */
+static uint32_t rng_state = 98765;
+static uint32_t next_random(void)
+{
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+static acp_session_t *session_for(uint64_t id)
+{
+    return &pool[id % POOL_SIZE];
+}
+
+/* Test argument validation and slot sizing */
+static int test_init(void)
+{
+    printf("\nTest 1: Initialization and sizing\n");
+    printf("=================================\n");
+
+    acp_session_table_t table;
+    if (acp_session_table_init(NULL, small_slots, 256, NULL, 1) != ACP_ERR_INVALID_PARAM ||
+        acp_session_table_init(&table, NULL, 256, NULL, 1) != ACP_ERR_INVALID_PARAM ||
+        acp_session_table_init(&table, small_slots, 200, NULL, 1) != ACP_ERR_INVALID_PARAM ||
+        acp_session_table_init(&table, small_slots, 256, NULL, 3) != ACP_ERR_INVALID_PARAM ||
+        acp_session_table_init(&table, small_slots, 256, NULL, 256) != ACP_ERR_INVALID_PARAM ||
+        acp_session_table_init(&table, small_slots, 256, NULL, 2 * ACP_SESSION_TABLE_MAX_STRIPES) !=
+            ACP_ERR_INVALID_PARAM)
+    {
+        printf("✗ Bad table arguments not rejected\n");
+        return 0;
+    }
+
+    if (acp_session_table_slots_needed(100, 3) != 0 ||
+        acp_session_table_slots_needed(7, 1) != 8 ||
+        acp_session_table_slots_needed(8, 1) != 16 ||
+        acp_session_table_slots_needed(LARGE_PEERS, 1) != LARGE_SLOTS ||
+        acp_session_table_slots_needed(LARGE_PEERS, 16) != LARGE_SLOTS ||
+        acp_session_table_slots_needed(14336, 8) != 32768)
+    {
+        printf("✗ Slot sizing wrong\n");
+        return 0;
+    }
+
+    if (acp_session_table_init(&table, small_slots, 256, NULL, 4) != ACP_OK ||
+        acp_session_table_count(&table) != 0)
+    {
+        printf("✗ Valid table not initialized empty\n");
+        return 0;
+    }
+
+    acp_session_t *found = NULL;
+    if (acp_session_table_insert(&table, 1, NULL) != ACP_ERR_INVALID_PARAM ||
+        acp_session_table_find(&table, 1, NULL) != ACP_ERR_INVALID_PARAM ||
+        acp_session_table_find(&table, 1, &found) != ACP_ERR_NOT_FOUND ||
+        acp_session_table_remove(&table, 1, NULL) != ACP_ERR_NOT_FOUND)
+    {
+        printf("✗ Empty table operations wrong\n");
+        return 0;
+    }
+
+    printf("✓ Arguments validated, sizing keeps each stripe under its limit\n");
+    return 1;
+}
+
+/* Test random operations against a model of which identifiers are present */
+static int test_model(void)
+{
+    printf("\nTest 2: Random operations against a model\n");
+    printf("=========================================\n");
+
+    static uint8_t present[MODEL_IDS];
+    memset(present, 0, sizeof(present));
+    size_t model_count = 0;
+
+    /* 128 slots per stripe against 300 identifiers: long probe runs and wraparound */
+    acp_session_table_t table;
+    acp_session_table_init(&table, small_slots, 256, NULL, 2);
+
+    for (uint32_t op = 0; op < MODEL_OPS; op++)
+    {
+        uint64_t id = next_random() % MODEL_IDS;
+        uint32_t kind = next_random() % 3;
+        acp_session_t *found = NULL;
+        acp_result_t result;
+
+        if (kind == 0)
+        {
+            result = acp_session_table_insert(&table, id, session_for(id));
+            if (present[id])
+            {
+                if (result != ACP_ERR_ALREADY_EXISTS)
+                {
+                    printf("✗ Duplicate insert of %llu gave %d\n", (unsigned long long)id, result);
+                    return 0;
+                }
+            }
+            else if (result == ACP_OK)
+            {
+                present[id] = 1;
+                model_count++;
+            }
+            else if (result != ACP_ERR_BUFFER_TOO_SMALL)
+            {
+                printf("✗ Insert of %llu gave %d\n", (unsigned long long)id, result);
+                return 0;
+            }
+        }
+        else if (kind == 1)
+        {
+            result = acp_session_table_find(&table, id, &found);
+            if (present[id] ? (result != ACP_OK || found != session_for(id)) : result != ACP_ERR_NOT_FOUND)
+            {
+                printf("✗ Lookup of %llu wrong at op %u\n", (unsigned long long)id, op);
+                return 0;
+            }
+        }
+        else
+        {
+            result = acp_session_table_remove(&table, id, &found);
+            if (present[id] ? (result != ACP_OK || found != session_for(id)) : result != ACP_ERR_NOT_FOUND)
+            {
+                printf("✗ Removal of %llu wrong at op %u\n", (unsigned long long)id, op);
+                return 0;
+            }
+            if (present[id])
+            {
+                present[id] = 0;
+                model_count--;
+            }
+        }
+
+        if (acp_session_table_count(&table) != model_count)
+        {
+            printf("✗ Count %zu, model has %zu\n", acp_session_table_count(&table), model_count);
+            return 0;
+        }
+    }
+
+    /* Every identifier, present or not, must still resolve correctly */
+    for (uint64_t id = 0; id < MODEL_IDS; id++)
+    {
+        acp_session_t *found = NULL;
+        acp_result_t result = acp_session_table_find(&table, id, &found);
+        if (present[id] ? (result != ACP_OK || found != session_for(id)) : result != ACP_ERR_NOT_FOUND)
+        {
+            printf("✗ Final lookup of %llu wrong\n", (unsigned long long)id);
+            return 0;
+        }
+    }
+
+    printf("✓ %d operations matched the model, %zu entries left\n", MODEL_OPS, model_count);
+    return 1;
+}
+
+/* Test a stripe stops accepting entries at its limit and recovers after removal */
+static int test_full(void)
+{
+    printf("\nTest 3: Full stripes\n");
+    printf("====================\n");
+
+    acp_session_table_t table;
+    acp_session_table_init(&table, small_slots, 16, NULL, 1);
+
+    uint64_t inserted = 0;
+    uint64_t id = 1000;
+    while (acp_session_table_insert(&table, id, session_for(id)) == ACP_OK)
+    {
+        inserted++;
+        id++;
+    }
+    if (inserted != 14 || acp_session_table_count(&table) != 14)
+    {
+        printf("✗ 16-slot stripe took %llu entries, expected 14\n", (unsigned long long)inserted);
+        return 0;
+    }
+
+    acp_session_t *found = NULL;
+    if (acp_session_table_find(&table, 1000 + inserted, &found) != ACP_ERR_NOT_FOUND ||
+        acp_session_table_remove(&table, 1003, NULL) != ACP_OK ||
+        acp_session_table_insert(&table, 1000 + inserted, session_for(1000 + inserted)) != ACP_OK)
+    {
+        printf("✗ Full stripe did not recover after a removal\n");
+        return 0;
+    }
+    for (uint64_t k = 1000; k <= 1000 + inserted; k++)
+    {
+        acp_result_t result = acp_session_table_find(&table, k, &found);
+        if (k == 1003 ? result != ACP_ERR_NOT_FOUND : (result != ACP_OK || found != session_for(k)))
+        {
+            printf("✗ Entry %llu lost in a full stripe\n", (unsigned long long)k);
+            return 0;
+        }
+    }
+
+    printf("✓ Stripe held 14 of 16 slots, misses still terminate\n");
+    return 1;
+}
+
+/* Test a gateway-sized table */
+static int test_large(void)
+{
+    printf("\nTest 4: %d peers\n", LARGE_PEERS);
+    printf("====================\n");
+
+    acp_session_table_t table;
+    if (acp_session_table_init(&table, large_slots, LARGE_SLOTS, NULL, 16) != ACP_OK)
+    {
+        printf("✗ Could not initialize large table\n");
+        return 0;
+    }
+
+    /* Sequential device identifiers, as a gateway assigning them would */
+    for (uint64_t id = 1; id <= LARGE_PEERS; id++)
+    {
+        if (acp_session_table_insert(&table, id, session_for(id)) != ACP_OK)
+        {
+            printf("✗ Insert of peer %llu failed\n", (unsigned long long)id);
+            return 0;
+        }
+    }
+    for (uint64_t id = 1; id <= LARGE_PEERS; id += 2)
+    {
+        if (acp_session_table_remove(&table, id, NULL) != ACP_OK)
+        {
+            printf("✗ Removal of peer %llu failed\n", (unsigned long long)id);
+            return 0;
+        }
+    }
+    for (uint64_t id = 1; id <= LARGE_PEERS + 10; id++)
+    {
+        acp_session_t *found = NULL;
+        acp_result_t result = acp_session_table_find(&table, id, &found);
+        int expected = (id <= LARGE_PEERS && id % 2 == 0);
+        if (expected ? (result != ACP_OK || found != session_for(id)) : result != ACP_ERR_NOT_FOUND)
+        {
+            printf("✗ Lookup of peer %llu wrong\n", (unsigned long long)id);
+            return 0;
+        }
+    }
+    if (acp_session_table_count(&table) != LARGE_PEERS / 2)
+    {
+        printf("✗ Count %zu after removing half\n", acp_session_table_count(&table));
+        return 0;
+    }
+
+    printf("✓ %d peers inserted, half removed, all lookups correct\n", LARGE_PEERS);
+    return 1;
+}
+
+/* Test a table sized by acp_session_table_slots_needed() takes the requested count */
+static int test_sized_fill(void)
+{
+    printf("\nTest 5: Sized tables fill to the requested count\n");
+    printf("================================================\n");
+
+    /* Even shares that land exactly on a stripe's load limit */
+    static const struct
+    {
+        size_t sessions;
+        uint32_t stripes;
+    } cases[] = {{100, 4}, {3584, 64}, {14336, 8}, {57344, 32}, {114688, 64}, {LARGE_PEERS, 16}};
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        size_t slots = acp_session_table_slots_needed(cases[c].sessions, cases[c].stripes);
+        for (int random_ids = 0; random_ids < 2; random_ids++)
+        {
+            acp_session_table_t table;
+            if (slots == 0 || slots > FILL_SLOTS ||
+                acp_session_table_init(&table, fill_slots, slots, NULL, cases[c].stripes) != ACP_OK)
+            {
+                printf("✗ %zu sessions over %u stripes: %zu slots\n", cases[c].sessions, cases[c].stripes, slots);
+                return 0;
+            }
+
+            /* Sequential identifiers, then random 64-bit ones */
+            for (size_t n = 0; n < cases[c].sessions; n++)
+            {
+                uint64_t id = n + 1;
+                if (random_ids)
+                {
+                    id = ((uint64_t)next_random() << 40) ^ ((uint64_t)next_random() << 16) ^ n;
+                }
+                if (acp_session_table_insert(&table, id, session_for(id)) != ACP_OK)
+                {
+                    printf("✗ %zu sessions over %u stripes: insert %zu failed\n",
+                           cases[c].sessions, cases[c].stripes, n);
+                    return 0;
+                }
+            }
+            if (acp_session_table_count(&table) != cases[c].sessions)
+            {
+                printf("✗ Count %zu, expected %zu\n", acp_session_table_count(&table), cases[c].sessions);
+                return 0;
+            }
+        }
+    }
+
+    printf("✓ Every sized table took its full count of sessions\n");
+    return 1;
+}
+
+#ifdef TABLE_TEST_THREADS
+
+static acp_session_table_t shared_table;
+
+typedef struct
+{
+    uint64_t base;
+    int errors;
+    int done;
+} worker_t;
+
+/* Each worker churns its own identifiers; stripes are shared between workers */
+static void *worker_main(void *arg)
+{
+    worker_t *worker = (worker_t *)arg;
+    for (int round = 0; round < 3; round++)
+    {
+        for (uint64_t id = worker->base; id < worker->base + WORKER_IDS; id++)
+        {
+            if (acp_session_table_insert(&shared_table, id, session_for(id)) != ACP_OK)
+            {
+                worker->errors++;
+            }
+        }
+        for (uint64_t id = worker->base; id < worker->base + WORKER_IDS; id++)
+        {
+            acp_session_t *found = NULL;
+            if (acp_session_table_find(&shared_table, id, &found) != ACP_OK || found != session_for(id))
+            {
+                worker->errors++;
+            }
+        }
+        /* Leave the odd identifiers in place after the last round */
+        for (uint64_t id = worker->base; id < worker->base + WORKER_IDS; id++)
+        {
+            if ((round < 2 || id % 2 == 0) && acp_session_table_remove(&shared_table, id, NULL) != ACP_OK)
+            {
+                worker->errors++;
+            }
+        }
+    }
+    ACP_ATOMIC_STORE_RELEASE(&worker->done, 1);
+    return NULL;
+}
+
+/* Test concurrent use of a striped table */
+static int test_threaded(void)
+{
+    printf("\nTest 6: Striped locking with %d threads\n", WORKERS);
+    printf("======================================\n");
+
+    acp_mutex_t *locks[WORKER_STRIPES];
+    for (int s = 0; s < WORKER_STRIPES; s++)
+    {
+        locks[s] = acp_platform_mutex_create();
+        if (locks[s] == NULL)
+        {
+            printf("✗ Could not create stripe lock\n");
+            return 0;
+        }
+    }
+    size_t slots = acp_session_table_slots_needed(WORKERS * WORKER_IDS, WORKER_STRIPES);
+    if (slots == 0 || slots > LARGE_SLOTS ||
+        acp_session_table_init(&shared_table, large_slots, slots, locks, WORKER_STRIPES) != ACP_OK)
+    {
+        printf("✗ Could not initialize striped table\n");
+        return 0;
+    }
+
+    pthread_t threads[WORKERS];
+    worker_t workers[WORKERS];
+    for (int w = 0; w < WORKERS; w++)
+    {
+        workers[w].base = (uint64_t)w * 1000000u;
+        workers[w].errors = 0;
+        workers[w].done = 0;
+        if (pthread_create(&threads[w], NULL, worker_main, &workers[w]) != 0)
+        {
+            printf("✗ Could not start worker thread\n");
+            return 0;
+        }
+    }
+    /* Count without locks while the workers run */
+    int running = WORKERS;
+    size_t snapshots = 0;
+    size_t peak = 0;
+    while (running > 0)
+    {
+        size_t count = acp_session_table_count(&shared_table);
+        peak = (count > peak) ? count : peak;
+        snapshots++;
+        running = 0;
+        for (int w = 0; w < WORKERS; w++)
+        {
+            running += !ACP_ATOMIC_LOAD_ACQUIRE(&workers[w].done);
+        }
+    }
+
+    int errors = 0;
+    for (int w = 0; w < WORKERS; w++)
+    {
+        pthread_join(threads[w], NULL);
+        errors += workers[w].errors;
+    }
+    for (int s = 0; s < WORKER_STRIPES; s++)
+    {
+        acp_platform_mutex_destroy(locks[s]);
+    }
+
+    if (errors != 0 || peak > WORKERS * WORKER_IDS ||
+        acp_session_table_count(&shared_table) != WORKERS * WORKER_IDS / 2)
+    {
+        printf("✗ %d errors, peak count %zu, %zu entries left\n", errors, peak,
+               acp_session_table_count(&shared_table));
+        return 0;
+    }
+
+    printf("✓ %d workers churned %d peers each without interference, %zu counts taken meanwhile\n",
+           WORKERS, WORKER_IDS, snapshots);
+    return 1;
+}
+
+#endif /* TABLE_TEST_THREADS */
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Session Table Tests\n");
+    printf("=======================\n");
+
+    int tests_passed = 0;
+    int total_tests = 5;
+
+    if (test_init())
+        tests_passed++;
+    if (test_model())
+        tests_passed++;
+    if (test_full())
+        tests_passed++;
+    if (test_large())
+        tests_passed++;
+    if (test_sized_fill())
+        tests_passed++;
+#ifdef TABLE_TEST_THREADS
+    total_tests += 1;
+    if (test_threaded())
+        tests_passed++;
+#endif
+
+    printf("\n=======================\n");
+    printf("Session Table Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All session table tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some session table tests FAILED\n");
+    return 1;
+}
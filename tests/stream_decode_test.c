@@ -0,0 +1,545 @@
+/**
+ * @file stream_decode_test.c
+ * @brief Incremental decoder tests for ACP
+ *
+ * Feeds an encoded stream to acp_decoder_decode() in fragments of various
+ * sizes and checks every frame is recovered exactly once, regardless of
+ * where the fragment boundaries fall. Decodes frames wrapped around a
+ * circular buffer with acp_decode_frame_split() at every seam position.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+
+#define STREAM_FRAMES 6
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+static const size_t frame_sizes[STREAM_FRAMES] = {0, 5, 254, 255, 700, ACP_MAX_PAYLOAD_SIZE};
+
+static uint8_t stream[STREAM_FRAMES * (ACP_MAX_FRAME_SIZE + 64)];
+static uint8_t decoder_buffer[ACP_DECODER_BUFFER_SIZE];
+
+static void fill_payload(uint8_t *payload, size_t len, uint8_t seed)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        payload[i] = (uint8_t)((i * 13 + seed) % 241);
+    }
+}
+
+/* Build a stream of frames, every other one authenticated */
+static size_t build_stream(acp_session_t *tx_session)
+{
+    size_t len = 0;
+    for (size_t f = 0; f < STREAM_FRAMES; f++)
+    {
+        uint8_t payload[ACP_MAX_PAYLOAD_SIZE];
+        fill_payload(payload, frame_sizes[f], (uint8_t)f);
+
+        size_t out_len = sizeof(stream) - len;
+        uint8_t flags = (f & 1) ? ACP_FLAG_AUTHENTICATED : 0;
+        if (acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, flags, payload, frame_sizes[f],
+                             tx_session, stream + len, &out_len) != ACP_OK)
+        {
+            return 0;
+        }
+        len += out_len;
+    }
+    return len;
+}
+
+/* Decode the stream in fixed-size fragments; return frames recovered or -1 */
+static int decode_fragmented(const uint8_t *data, size_t len, size_t fragment)
+{
+    acp_session_t rx_session;
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+
+    acp_decoder_t decoder;
+    if (acp_decoder_init(&decoder, decoder_buffer, sizeof(decoder_buffer)) != ACP_OK)
+    {
+        return -1;
+    }
+
+    int frames = 0;
+    for (size_t off = 0; off < len; off += fragment)
+    {
+        const uint8_t *chunk = data + off;
+        size_t chunk_len = (len - off < fragment) ? len - off : fragment;
+
+        while (chunk_len > 0)
+        {
+            acp_frame_view_t view;
+            size_t consumed = 0;
+            acp_result_t result = acp_decoder_decode(&decoder, chunk, chunk_len, &consumed,
+                                                     &view, &rx_session);
+            if (consumed == 0 || consumed > chunk_len)
+            {
+                return -1;
+            }
+            chunk += consumed;
+            chunk_len -= consumed;
+
+            if (result == ACP_OK)
+            {
+                uint8_t expected[ACP_MAX_PAYLOAD_SIZE];
+                fill_payload(expected, frame_sizes[frames], (uint8_t)frames);
+                if (frames >= STREAM_FRAMES || view.length != frame_sizes[frames] ||
+                    memcmp(view.payload, expected, view.length) != 0)
+                {
+                    return -1;
+                }
+                frames++;
+            }
+            else if (result != ACP_ERR_NEED_MORE_DATA)
+            {
+                return -1;
+            }
+        }
+    }
+    return frames;
+}
+
+/* Test that fragmentation does not affect the decoded frames */
+static int test_fragmentation(void)
+{
+    printf("\nTest 1: Fragmented stream decode\n");
+    printf("================================\n");
+
+    acp_session_t tx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    size_t len = build_stream(&tx_session);
+    if (len == 0)
+    {
+        printf("✗ Stream encode failed\n");
+        return 0;
+    }
+
+    static const size_t fragments[] = {1, 2, 3, 7, 16, 17, 64, 255, 1500, sizeof(stream)};
+    for (size_t i = 0; i < sizeof(fragments) / sizeof(fragments[0]); i++)
+    {
+        int frames = decode_fragmented(stream, len, fragments[i]);
+        if (frames != STREAM_FRAMES)
+        {
+            printf("✗ %zu-byte fragments: recovered %d of %d frames\n", fragments[i], frames, STREAM_FRAMES);
+            return 0;
+        }
+    }
+    printf("✓ %d frames (%zu bytes) recovered for all fragment sizes\n", STREAM_FRAMES, len);
+    return 1;
+}
+
+/* Test recovery from leading garbage and a corrupted frame */
+static int test_error_recovery(void)
+{
+    printf("\nTest 2: Error recovery\n");
+    printf("======================\n");
+
+    uint8_t data[256];
+    size_t len = 0;
+    static const uint8_t garbage[] = {0x37, 0x42, 0x99};
+    memcpy(data, garbage, sizeof(garbage));
+    len += sizeof(garbage);
+
+    uint8_t payload[] = {0x01, 0x00, 0x02, 0x00};
+    size_t out_len = sizeof(data) - len;
+    acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizeof(payload), NULL, data + len, &out_len);
+    size_t bad_start = len;
+    size_t bad_len = out_len;
+    len += out_len;
+    out_len = sizeof(data) - len;
+    acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizeof(payload), NULL, data + len, &out_len);
+    len += out_len;
+
+    /* Corrupt a payload byte of the first frame without touching zeros */
+    data[bad_start + 8] ^= 0x40;
+
+    acp_decoder_t decoder;
+    acp_decoder_init(&decoder, decoder_buffer, sizeof(decoder_buffer));
+
+    int crc_errors = 0;
+    int frames = 0;
+    size_t pos = 0;
+    while (pos < len)
+    {
+        acp_frame_view_t view;
+        size_t consumed = 0;
+        acp_result_t result = acp_decoder_decode(&decoder, data + pos, len - pos, &consumed, &view, NULL);
+        pos += consumed;
+        if (result == ACP_OK)
+        {
+            frames++;
+        }
+        else if (result == ACP_ERR_CRC_MISMATCH)
+        {
+            crc_errors++;
+        }
+        else if (result != ACP_ERR_NEED_MORE_DATA)
+        {
+            printf("✗ Unexpected result %d\n", result);
+            return 0;
+        }
+    }
+
+    if (frames != 1 || crc_errors != 1)
+    {
+        printf("✗ Expected 1 frame and 1 CRC error, got %d and %d\n", frames, crc_errors);
+        return 0;
+    }
+
+    /* The rejected frame's closing delimiter opens the next one */
+    if (decoder.bytes_skipped != sizeof(garbage) + bad_len - 1 || decoder.frames_rejected != 1)
+    {
+        printf("✗ Counters: %llu bytes skipped, %u frames rejected\n",
+               (unsigned long long)decoder.bytes_skipped, decoder.frames_rejected);
+        return 0;
+    }
+    printf("✓ Garbage skipped, corrupted frame rejected, next frame decoded\n");
+    return 1;
+}
+
+/* Test that a partial frame is not rescanned when more data arrives */
+static int test_no_rescan(void)
+{
+    printf("\nTest 3: Input absorbed on NEED_MORE_DATA\n");
+    printf("========================================\n");
+
+    uint8_t payload[400];
+    uint8_t encoded[ACP_MAX_FRAME_SIZE + 64];
+    size_t encoded_len = sizeof(encoded);
+    fill_payload(payload, sizeof(payload), 9);
+    acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizeof(payload), NULL, encoded, &encoded_len);
+
+    acp_decoder_t decoder;
+    acp_decoder_init(&decoder, decoder_buffer, sizeof(decoder_buffer));
+
+    acp_frame_view_t view;
+    size_t consumed = 0;
+    size_t half = encoded_len / 2;
+    acp_result_t result = acp_decoder_decode(&decoder, encoded, half, &consumed, &view, NULL);
+    if (result != ACP_ERR_NEED_MORE_DATA || consumed != half)
+    {
+        printf("✗ First half not absorbed: result %d, consumed %zu\n", result, consumed);
+        return 0;
+    }
+
+    /* Overwrite the first half: the decoder must not look at it again */
+    memset(encoded, 0xEE, half);
+    result = acp_decoder_decode(&decoder, encoded + half, encoded_len - half, &consumed, &view, NULL);
+    if (result != ACP_OK || consumed != encoded_len - half || view.length != sizeof(payload) ||
+        memcmp(view.payload, payload, sizeof(payload)) != 0)
+    {
+        printf("✗ Second half did not complete the frame: %d\n", result);
+        return 0;
+    }
+    printf("✓ Frame completed from two halves without retaining input\n");
+    return 1;
+}
+
+/* Test frames decode in place across a circular buffer's wrap point */
+static int test_wraparound(void)
+{
+    printf("\nTest 4: Decode across ring wraparound\n");
+    printf("=====================================\n");
+
+    static uint8_t ring[ACP_MAX_FRAME_SIZE + 64];
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+
+    acp_session_t tx_session, rx_base;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_base, 1, test_key, sizeof(test_key), 0x1234);
+    size_t stream_len = build_stream(&tx_session);
+
+    /* Locate each frame: it ends where acp_decode_frame_view says */
+    size_t pos = 0;
+    int seams = 0;
+    for (size_t f = 0; f < STREAM_FRAMES; f++)
+    {
+        acp_frame_view_t view;
+        size_t frame_len = 0;
+        acp_session_t rx = rx_base;
+        if (acp_decode_frame_view(stream + pos, stream_len - pos, decode_buf, sizeof(decode_buf),
+                                  &view, &frame_len, &rx) != ACP_OK)
+        {
+            printf("✗ Frame %zu did not decode contiguously\n", f);
+            return 0;
+        }
+
+        uint8_t payload[ACP_MAX_PAYLOAD_SIZE];
+        fill_payload(payload, frame_sizes[f], (uint8_t)f);
+
+        /* Place the frame so the wrap point falls at every byte, tag included */
+        for (size_t split = 0; split <= frame_len; split++)
+        {
+            size_t start = sizeof(ring) - split;
+            memcpy(ring + start, stream + pos, split);
+            memcpy(ring, stream + pos + split, frame_len - split);
+
+            size_t consumed = 0;
+            rx = rx_base;
+            acp_result_t result = acp_decode_frame_split(ring + start, split, ring, frame_len - split,
+                                                         decode_buf, sizeof(decode_buf), &view, &consumed, &rx);
+            if (result != ACP_OK || consumed != frame_len || view.length != frame_sizes[f] ||
+                memcmp(view.payload, payload, frame_sizes[f]) != 0)
+            {
+                printf("✗ Frame %zu split at %zu: result %d, consumed %zu of %zu\n",
+                       f, split, result, consumed, frame_len);
+                return 0;
+            }
+            if ((view.flags & ACP_FLAG_AUTHENTICATED) &&
+                memcmp(view.hmac_tag, stream + pos + frame_len - ACP_HMAC_TAG_LEN, ACP_HMAC_TAG_LEN) != 0)
+            {
+                printf("✗ Frame %zu split at %zu: wrong tag reported\n", f, split);
+                return 0;
+            }
+
+            /* One byte short across the seam is incomplete, not an error */
+            if (split < frame_len)
+            {
+                rx = rx_base;
+                result = acp_decode_frame_split(ring + start, split, ring, frame_len - split - 1,
+                                                decode_buf, sizeof(decode_buf), &view, &consumed, &rx);
+                if (result != ACP_ERR_NEED_MORE_DATA)
+                {
+                    printf("✗ Truncated frame %zu split at %zu: result %d\n", f, split, result);
+                    return 0;
+                }
+            }
+            seams++;
+        }
+
+        rx_base = rx;
+        pos += frame_len;
+    }
+
+    /* A tampered byte after the seam still fails authentication */
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_base, 1, test_key, sizeof(test_key), 0x1234);
+    stream_len = build_stream(&tx_session);
+    size_t first_len = 0;
+    acp_frame_view_t view;
+    acp_session_t rx = rx_base;
+    acp_decode_frame_view(stream, stream_len, decode_buf, sizeof(decode_buf), &view, &first_len, &rx);
+    size_t second_len = 0;
+    acp_decode_frame_view(stream + first_len, stream_len - first_len, decode_buf, sizeof(decode_buf),
+                          &view, &second_len, &rx);
+    uint8_t *second = stream + first_len;
+    second[second_len - ACP_HMAC_TAG_LEN - 2] ^= 0x01; /* Last encoded byte: CRC byte */
+    size_t consumed = 0;
+    acp_result_t result = acp_decode_frame_split(second, 4, second + 4, second_len - 4,
+                                                 decode_buf, sizeof(decode_buf), &view, &consumed, &rx_base);
+    if (result == ACP_OK)
+    {
+        printf("✗ Corrupted split frame accepted\n");
+        return 0;
+    }
+
+    printf("✓ %d seam positions decoded in place\n", seams);
+    return 1;
+}
+
+/* Test stateless decode skips noise and damaged frames in one step each */
+static int test_linear_resync(void)
+{
+    printf("\nTest 5: Stateless resync is linear\n");
+    printf("==================================\n");
+
+    static uint8_t data[8192];
+    uint8_t decode_buf[ACP_DECODE_BUFFER_SIZE];
+    uint8_t payload[200];
+    fill_payload(payload, sizeof(payload), 3);
+    size_t len = 0;
+    int good = 0;
+
+    for (int round = 0; round < 4; round++)
+    {
+        /* Long zero-free noise run */
+        for (size_t i = 0; i < 1000; i++)
+        {
+            data[len++] = (uint8_t)(1 + (i * 37 + round) % 255);
+        }
+
+        /* Frame with a flipped payload byte (CRC), then one cut short (COBS) */
+        size_t out_len = sizeof(data) - len;
+        acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizeof(payload), NULL, data + len, &out_len);
+        data[len + 50] ^= 0x20;
+        len += out_len;
+        out_len = sizeof(data) - len;
+        acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizeof(payload), NULL, data + len, &out_len);
+        data[len + 30] = 0x00;
+        len += out_len;
+
+        out_len = sizeof(data) - len;
+        acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, payload, sizeof(payload), NULL, data + len, &out_len);
+        len += out_len;
+        good++;
+    }
+
+    size_t delimiters = 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        delimiters += (data[i] == 0x00);
+    }
+
+    /* The documented caller loop: skip what was consumed, at least one byte */
+    int frames = 0;
+    size_t calls = 0;
+    size_t pos = 0;
+    while (pos < len)
+    {
+        acp_frame_view_t view;
+        size_t consumed = 0;
+        acp_result_t result = acp_decode_frame_view(data + pos, len - pos, decode_buf, sizeof(decode_buf),
+                                                     &view, &consumed, NULL);
+        calls++;
+        if (result == ACP_ERR_NEED_MORE_DATA)
+        {
+            break;
+        }
+        if (result == ACP_OK)
+        {
+            if (view.length != sizeof(payload) || memcmp(view.payload, payload, sizeof(payload)) != 0)
+            {
+                printf("✗ Recovered frame corrupted\n");
+                return 0;
+            }
+            frames++;
+        }
+        pos += consumed ? consumed : 1;
+    }
+
+    /* Every call starts at a delimiter except the very first */
+    if (frames != good || calls > delimiters + 1)
+    {
+        printf("✗ %d of %d frames in %zu calls (%zu delimiters)\n", frames, good, calls, delimiters);
+        return 0;
+    }
+    printf("✓ %d frames recovered from %zu bytes in %zu calls\n", frames, len, calls);
+    return 1;
+}
+
+/* Test a truncated authenticated frame does not take the next frame as its tag */
+static int test_truncated_auth(void)
+{
+    printf("\nTest 6: Truncated authenticated frame\n");
+    printf("=====================================\n");
+
+    uint8_t data[256];
+    uint8_t payload[40];
+    for (size_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (i % 8 == 7) ? 0x00 : (uint8_t)(i + 1);
+    }
+
+    acp_session_t tx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    size_t auth_len = sizeof(data);
+    acp_encode_frame(ACP_FRAME_TYPE_COMMAND, ACP_FLAG_AUTHENTICATED, payload, sizeof(payload),
+                     &tx_session, data, &auth_len);
+
+    /* Cut after the third COBS block, so the next opening delimiter reads as a closing one */
+    size_t cut = 1;
+    for (int block = 0; block < 3; block++)
+    {
+        cut += data[cut];
+    }
+
+    static const uint8_t telemetry[] = {0x11, 0x22, 0x33};
+    size_t len = cut;
+    size_t out_len = sizeof(data) - len;
+    acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, 0, telemetry, sizeof(telemetry), NULL, data + len, &out_len);
+    len += out_len;
+
+    acp_session_t rx_session;
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_decoder_t decoder;
+    acp_decoder_init(&decoder, decoder_buffer, sizeof(decoder_buffer));
+
+    int frames = 0;
+    int errors = 0;
+    size_t pos = 0;
+    while (pos < len)
+    {
+        acp_frame_view_t view;
+        size_t consumed = 0;
+        acp_result_t result = acp_decoder_decode(&decoder, data + pos, len - pos, &consumed, &view, &rx_session);
+        pos += consumed;
+        if (result == ACP_OK)
+        {
+            if (view.type != ACP_FRAME_TYPE_TELEMETRY || view.length != sizeof(telemetry) ||
+                memcmp(view.payload, telemetry, sizeof(telemetry)) != 0)
+            {
+                printf("✗ Wrong frame delivered\n");
+                return 0;
+            }
+            frames++;
+        }
+        else if (result == ACP_ERR_NEED_MORE_DATA)
+        {
+            break;
+        }
+        else
+        {
+            errors++;
+        }
+    }
+
+    if (frames != 1 || errors != 1 || decoder.bytes_skipped != cut)
+    {
+        printf("✗ %d frames, %d errors, %llu bytes skipped\n", frames, errors,
+               (unsigned long long)decoder.bytes_skipped);
+        return 0;
+    }
+    printf("✓ Truncated frame rejected at the next delimiter, next frame decoded\n");
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Stream Decode Tests\n");
+    printf("=======================\n");
+
+    if (acp_init() != ACP_OK)
+    {
+        printf("Failed to initialize ACP\n");
+        return 1;
+    }
+
+    int tests_passed = 0;
+    int total_tests = 6;
+
+    if (test_fragmentation())
+        tests_passed++;
+    if (test_error_recovery())
+        tests_passed++;
+    if (test_no_rescan())
+        tests_passed++;
+    if (test_wraparound())
+        tests_passed++;
+    if (test_linear_resync())
+        tests_passed++;
+    if (test_truncated_auth())
+        tests_passed++;
+
+    acp_cleanup();
+
+    printf("\n=======================\n");
+    printf("Stream Decode Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All stream decode tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some stream decode tests FAILED\n");
+    return 1;
+}
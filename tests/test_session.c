@@ -85,14 +85,14 @@ int main(void)
     result = acp_session_check_rx_seq(&session, 105);
     printf("Replay seq 105: %s\n", result == ACP_ERR_REPLAY ? "PASS (rejected)" : "FAIL (accepted)");
 
-    printf("Last accepted: %u\n", session.last_accepted_seq);
+    printf("Last accepted: %llu\n", (unsigned long long)session.last_accepted_seq);
     printf("\n");
 
     /* Test 4: Session Status */
     printf("Test 4: Session Status\n");
     printf("Key ID: 0x%08x\n", session.key_id);
-    printf("Next TX seq: %u\n", session.next_sequence);
-    printf("Last RX seq: %u\n", session.last_accepted_seq);
+    printf("Next TX seq: %llu\n", (unsigned long long)session.next_sequence);
+    printf("Last RX seq: %llu\n", (unsigned long long)session.last_accepted_seq);
     printf("Initialized: %s\n", acp_session_is_initialized(&session) ? "YES" : "NO");
     printf("Policy flags: 0x%02x\n", session.policy_flags);
     printf("\n");
@@ -0,0 +1,265 @@
+/**
+ * @file tx_test.c
+ * @brief Zero-copy transmit tests for ACP
+ *
+ * Builds payloads directly in acp_tx_reserve() spans and checks that
+ * acp_tx_commit() produces exactly the bytes acp_encode_frame() would,
+ * including worst-case COBS overhead where the in-place stuffer runs
+ * closest to the payload it is reading.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "acp_protocol.h"
+
+#define TX_BUFFER_SIZE (8 * ACP_TX_RESERVE_SIZE(ACP_MAX_PAYLOAD_SIZE))
+
+static const uint8_t test_key[ACP_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+static uint8_t tx_storage[TX_BUFFER_SIZE];
+static uint8_t reference[TX_BUFFER_SIZE];
+
+/* Payload patterns stressing different COBS block layouts */
+static void fill_payload(uint8_t *payload, size_t len, int pattern)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        switch (pattern)
+        {
+        case 0: /* No zeros: every block is full length */
+            payload[i] = (uint8_t)(1 + i % 255);
+            break;
+        case 1: /* All zeros: one code byte per input byte */
+            payload[i] = 0;
+            break;
+        default: /* Mixed */
+            payload[i] = (uint8_t)((i * 7) % 13 == 0 ? 0 : i * 31);
+            break;
+        }
+    }
+}
+
+/* Test committed frames match acp_encode_frame byte for byte */
+static int test_commit_matches_encode(void)
+{
+    printf("\nTest 1: Committed frames match acp_encode_frame\n");
+    printf("===============================================\n");
+
+    static const size_t sizes[] = {0, 1, 253, 254, 255, 508, 700, ACP_MAX_PAYLOAD_SIZE};
+    static uint8_t payload[ACP_MAX_PAYLOAD_SIZE];
+    int frames = 0;
+
+    for (int pattern = 0; pattern < 3; pattern++)
+    {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            for (int auth = 0; auth < 2; auth++)
+            {
+                acp_session_t tx_session, ref_session;
+                acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+                acp_session_init(&ref_session, 1, test_key, sizeof(test_key), 0x1234);
+
+                size_t len = sizes[s];
+                uint8_t flags = auth ? ACP_FLAG_AUTHENTICATED : 0;
+                fill_payload(payload, len, pattern);
+
+                acp_tx_buffer_t tx;
+                acp_tx_span_t span;
+                acp_tx_init(&tx, tx_storage, sizeof(tx_storage), &tx_session);
+                if (acp_tx_reserve(&tx, ACP_MAX_PAYLOAD_SIZE, &span) != ACP_OK)
+                {
+                    printf("✗ Reserve failed\n");
+                    return 0;
+                }
+                memcpy(span.payload, payload, len); /* Producer builds the payload in place */
+                acp_result_t result = acp_tx_commit(&span, ACP_FRAME_TYPE_TELEMETRY, flags, len);
+
+                size_t ref_len = sizeof(reference);
+                acp_encode_frame(ACP_FRAME_TYPE_TELEMETRY, flags, payload, len, &ref_session, reference, &ref_len);
+
+                if (result != ACP_OK || tx.length != ref_len || memcmp(tx.buffer, reference, ref_len) != 0)
+                {
+                    printf("✗ Pattern %d, %zu bytes, auth %d: result %d, %zu vs %zu bytes\n",
+                           pattern, len, auth, result, tx.length, ref_len);
+                    return 0;
+                }
+                if (acp_session_get_next_sequence(&tx_session) != acp_session_get_next_sequence(&ref_session))
+                {
+                    printf("✗ Sequence numbers diverged\n");
+                    return 0;
+                }
+                frames++;
+            }
+        }
+    }
+
+    printf("✓ %d frames identical to acp_encode_frame output\n", frames);
+    return 1;
+}
+
+/* Test frames pack back to back and decode as one stream */
+static int test_commit_packing(void)
+{
+    printf("\nTest 2: Committed frames pack into one stream\n");
+    printf("=============================================\n");
+
+    acp_session_t tx_session, rx_session;
+    acp_session_init(&tx_session, 1, test_key, sizeof(test_key), 0x1234);
+    acp_session_init(&rx_session, 1, test_key, sizeof(test_key), 0x1234);
+
+    acp_tx_buffer_t tx;
+    acp_tx_init(&tx, tx_storage, sizeof(tx_storage), &tx_session);
+
+    /* Reserve generously, write less; later frames start right after earlier ones */
+    int committed = 0;
+    for (size_t f = 0; f < 6; f++)
+    {
+        acp_tx_span_t span;
+        if (acp_tx_reserve(&tx, 512, &span) != ACP_OK)
+        {
+            printf("✗ Reserve %zu failed\n", f);
+            return 0;
+        }
+        size_t len = 40 * f + 3;
+        fill_payload(span.payload, len, 2);
+        span.payload[0] = (uint8_t)f;
+        uint8_t type = (f & 1) ? ACP_FRAME_TYPE_COMMAND : ACP_FRAME_TYPE_TELEMETRY;
+        uint8_t flags = (f & 1) ? ACP_FLAG_AUTHENTICATED : 0;
+        if (acp_tx_commit(&span, type, flags, len) != ACP_OK)
+        {
+            printf("✗ Commit %zu failed\n", f);
+            return 0;
+        }
+        committed++;
+    }
+
+    size_t pos = 0;
+    for (int f = 0; f < committed; f++)
+    {
+        acp_frame_t frame;
+        size_t consumed = 0;
+        acp_result_t result = acp_decode_frame(tx.buffer + pos, tx.length - pos, &frame, &consumed, &rx_session);
+        if (result != ACP_OK || frame.length != 40 * (size_t)f + 3 || frame.payload[0] != (uint8_t)f)
+        {
+            printf("✗ Frame %d did not decode: %d\n", f, result);
+            return 0;
+        }
+        pos += consumed;
+    }
+    if (pos != tx.length)
+    {
+        printf("✗ %zu trailing bytes after the last frame\n", tx.length - pos);
+        return 0;
+    }
+
+    acp_tx_reset(&tx);
+    if (tx.length != 0)
+    {
+        printf("✗ Reset did not empty the buffer\n");
+        return 0;
+    }
+
+    printf("✓ %d frames, %zu bytes decoded as one stream\n", committed, pos);
+    return 1;
+}
+
+/* Test reservation misuse and failed commits leave the buffer intact */
+static int test_reserve_errors(void)
+{
+    printf("\nTest 3: Reservation errors\n");
+    printf("==========================\n");
+
+    acp_session_t session;
+    acp_session_init(&session, 1, test_key, sizeof(test_key), 0x1234);
+
+    acp_tx_buffer_t tx;
+    acp_tx_span_t span, second;
+    acp_tx_init(&tx, tx_storage, ACP_TX_RESERVE_SIZE(100) + ACP_TX_RESERVE_SIZE(16), &session);
+
+    if (acp_tx_reserve(&tx, ACP_MAX_PAYLOAD_SIZE + 1, &span) != ACP_ERR_PAYLOAD_TOO_LARGE ||
+        acp_tx_reserve(&tx, 200, &span) != ACP_ERR_BUFFER_TOO_SMALL)
+    {
+        printf("✗ Oversized reservation not rejected\n");
+        return 0;
+    }
+
+    if (acp_tx_reserve(&tx, 100, &span) != ACP_OK ||
+        acp_tx_reserve(&tx, 16, &second) != ACP_ERR_INVALID_PARAM)
+    {
+        printf("✗ Second outstanding reservation not rejected\n");
+        return 0;
+    }
+
+    /* Commit rejected: too long, then policy; the reservation is released each time */
+    if (acp_tx_commit(&span, ACP_FRAME_TYPE_TELEMETRY, 0, 101) != ACP_ERR_PAYLOAD_TOO_LARGE ||
+        tx.length != 0 || tx.reserved != 0)
+    {
+        printf("✗ Overlong commit not rejected cleanly\n");
+        return 0;
+    }
+    acp_tx_reserve(&tx, 100, &span);
+    if (acp_tx_commit(&span, ACP_FRAME_TYPE_COMMAND, 0, 10) != ACP_ERR_AUTH_REQUIRED || tx.length != 0)
+    {
+        printf("✗ Unauthenticated command not rejected\n");
+        return 0;
+    }
+    if (acp_tx_commit(&span, ACP_FRAME_TYPE_TELEMETRY, 0, 10) != ACP_ERR_INVALID_PARAM)
+    {
+        printf("✗ Commit of a released span not rejected\n");
+        return 0;
+    }
+
+    /* Abort releases the space for the next reservation */
+    acp_tx_reserve(&tx, 100, &span);
+    acp_tx_abort(&span);
+    if (tx.reserved != 0 || acp_tx_reserve(&tx, 100, &span) != ACP_OK)
+    {
+        printf("✗ Abort did not release the reservation\n");
+        return 0;
+    }
+    if (acp_tx_commit(&span, ACP_FRAME_TYPE_TELEMETRY, 0, 100) != ACP_OK ||
+        acp_tx_reserve(&tx, 16, &second) != ACP_OK)
+    {
+        printf("✗ Buffer space not reusable after abort\n");
+        return 0;
+    }
+    acp_tx_abort(&second);
+
+    printf("✓ Misuse rejected, failed commits leave the buffer unchanged\n");
+    return 1;
+}
+
+/* Main test runner */
+int main(void)
+{
+    printf("ACP Zero-Copy Transmit Tests\n");
+    printf("============================\n");
+
+    int tests_passed = 0;
+    int total_tests = 3;
+
+    if (test_commit_matches_encode())
+        tests_passed++;
+    if (test_commit_packing())
+        tests_passed++;
+    if (test_reserve_errors())
+        tests_passed++;
+
+    printf("\n============================\n");
+    printf("Transmit Test Results: %d/%d passed\n", tests_passed, total_tests);
+
+    if (tests_passed == total_tests)
+    {
+        printf("✅ All transmit tests PASSED\n");
+        return 0;
+    }
+
+    printf("❌ Some transmit tests FAILED\n");
+    return 1;
+}